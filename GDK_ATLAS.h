@@ -0,0 +1,332 @@
+#ifndef GDK_ATLAS_H
+#define GDK_ATLAS_H
+
+// --- TEXTURE ATLAS PACKER ---
+// Merges the skins of a group of legacy models (MDL/MD2/MD3) and the TPAGEs of PRM cars into one
+// shared atlas and rewrites their UVs, so the whole group draws without a single texture change.
+// Packing is skyline bottom-left. Every cell is padded with edge-extended texels and aligned to a
+// power of two, and MAX_LEVEL is capped so mips never average across a neighbour.
+// Textures whose UVs tile (outside 0..1) are left alone - clamping them would break the wrap.
+
+#define GDK_ATLAS_UV_EPS 0.001f
+
+struct GDK_Internal_AtlasItem {
+    uint32_t tid = 0;
+    int w = 0, h = 0;
+    int cw = 0, ch = 0;    // Cell size incl. padding, aligned
+    int x = 0, y = 0;      // Cell position
+    bool tiling = false;   // Some holder samples outside 0..1
+    bool packed = false;
+    std::vector<uint8_t> pixels;
+};
+
+struct GDK_Internal_SkylineNode { int x, y, w; };
+
+static int g_AtlasCount = 0;
+
+// GL texture -> RGBA8, finest resident level, bottom-up (Compressed textures come back decoded).
+// Streamed textures only have their base level and below, so read that rather than level 0.
+static bool GDK_Internal_ReadTexture(uint32_t tid, int& w, int& h, std::vector<uint8_t>& out) {
+    glBindTexture(GL_TEXTURE_2D, tid);
+    GLint base = 0;
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, &base);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, base, GL_TEXTURE_WIDTH, &w);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, base, GL_TEXTURE_HEIGHT, &h);
+    if (w <= 0 || h <= 0) return false;
+    out.resize((size_t)w * h * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTexImage(GL_TEXTURE_2D, base, GL_RGBA, GL_UNSIGNED_BYTE, out.data());
+    return true;
+}
+
+// Bottom-left skyline fit. Returns false if 'item' does not fit in a size x size page.
+static bool GDK_Internal_SkylineInsert(std::vector<GDK_Internal_SkylineNode>& sky, int size, GDK_Internal_AtlasItem& item) {
+    int bestIdx = -1, bestX = 0, bestY = INT32_MAX, bestTop = INT32_MAX;
+
+    for (int i = 0; i < (int)sky.size(); ++i) {
+        int x = sky[i].x;
+        if (x + item.cw > size) break;
+
+        // Highest skyline under the span
+        int y = 0, covered = 0;
+        for (int j = i; j < (int)sky.size() && covered < item.cw; ++j) {
+            y = std::max(y, sky[j].y);
+            covered += sky[j].w;
+        }
+        int top = y + item.ch;
+        if (top > size) continue;
+        if (top < bestTop || (top == bestTop && x < bestX)) { bestIdx = i; bestX = x; bestY = y; bestTop = top; }
+    }
+    if (bestIdx < 0) return false;
+
+    item.x = bestX; item.y = bestY;
+
+    // New segment, then trim everything it shadows
+    sky.insert(sky.begin() + bestIdx, { bestX, bestTop, item.cw });
+    for (size_t i = bestIdx + 1; i < sky.size(); ) {
+        int end = sky[i - 1].x + sky[i - 1].w;
+        if (sky[i].x >= end) break;
+        int shrink = end - sky[i].x;
+        if (shrink >= sky[i].w) { sky.erase(sky.begin() + i); continue; }
+        sky[i].x += shrink; sky[i].w -= shrink;
+        break;
+    }
+    for (size_t i = 1; i < sky.size(); ) { // Merge flat runs
+        if (sky[i].y == sky[i - 1].y) { sky[i - 1].w += sky[i].w; sky.erase(sky.begin() + i); }
+        else ++i;
+    }
+    return true;
+}
+
+// Packs as many candidates as fit (Tallest first). Returns the count placed.
+static int GDK_Internal_PackAtlas(std::vector<GDK_Internal_AtlasItem*>& items, int size) {
+    std::vector<GDK_Internal_SkylineNode> sky = { { 0, 0, size } };
+    int placed = 0;
+    for (auto* it : items) {
+        it->packed = GDK_Internal_SkylineInsert(sky, size, *it);
+        if (it->packed) placed++;
+    }
+    return placed;
+}
+
+static bool GDK_Internal_UVsInRange(float s, float t) {
+    return s >= -GDK_ATLAS_UV_EPS && s <= 1.0f + GDK_ATLAS_UV_EPS && t >= -GDK_ATLAS_UV_EPS && t <= 1.0f + GDK_ATLAS_UV_EPS;
+}
+
+// (s,t) in the item's own space -> atlas space
+static inline void GDK_Internal_AtlasRemap(const GDK_Internal_AtlasItem& it, int pad, int size, float& s, float& t) {
+    s = ((float)(it.x + pad) + s * (float)it.w) / (float)size;
+    t = ((float)(it.y + pad) + t * (float)it.h) / (float)size;
+}
+
+// Vertex ranges a legacy model draws with defaultTex. MD3 surfaces with their own skin keep their UVs.
+static std::vector<std::pair<uint32_t, uint32_t>> GDK_Internal_AtlasDefaultRanges(const GDK_Legacy_Model& lm) {
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    if (lm.frames.empty()) return ranges;
+    if (lm.surfaces.empty()) {
+        ranges.push_back({ 0, (uint32_t)lm.frames[0].size() });
+        return ranges;
+    }
+    for (const auto& surf : lm.surfaces) {
+        if (!surf.texture && surf.numVerts) ranges.push_back({ surf.firstVert, surf.numVerts });
+    }
+    return ranges;
+}
+
+GDK_BEGIN_DECLS
+
+// Packs the textures of 'count' models (GDK model indices) into one atlas of at most maxSize x maxSize.
+// padding is per side (Default 4 when <= 0). Returns the atlas texture index, or -1 if nothing was packed.
+// The models own the atlas references - do not GDK_FreeTexture the returned index.
+GDK_API int GDK_Atlas_Build(const int* modelIdx, int count, int maxSize, int padding) {
+    if (!modelIdx || count <= 0) return -1;
+    if (maxSize <= 0) maxSize = 4096;
+    if (padding <= 0) padding = 4;
+    auto t0 = std::chrono::high_resolution_clock::now();
+
+    // Cells align to a power of two >= padding, so each mip level up to log2(align) keeps >= 1 border texel
+    int align = 4, maxLevel = 2;
+    while (align < padding) { align *= 2; maxLevel++; }
+
+    // 1. Gather unique textures and flag anything sampled with tiling UVs
+    std::vector<GDK_Internal_AtlasItem> items;
+    std::unordered_map<uint32_t, int> byName;
+    auto ItemFor = [&](uint32_t tid) -> GDK_Internal_AtlasItem* {
+        if (tid == 0) return nullptr;
+        auto it = byName.find(tid);
+        if (it != byName.end()) return &items[it->second];
+        byName[tid] = (int)items.size();
+        items.emplace_back();
+        items.back().tid = tid;
+        return &items.back();
+    };
+
+    for (int i = 0; i < count; ++i) {
+        int m = modelIdx[i];
+        if (m < 0 || (size_t)m >= gdk_models.size()) continue;
+        const GDK_Model_Master& master = gdk_models[m];
+
+        if (master.TypeID == MDL || master.TypeID == MD2 || master.TypeID == MD3) {
+            const GDK_Legacy_Model& lm = g_ModelStore[master.InternalIndex];
+            auto ranges = GDK_Internal_AtlasDefaultRanges(lm);
+            if (ranges.empty()) continue; // Every surface has its own skin
+            GDK_Internal_AtlasItem* it = ItemFor((uint32_t)lm.defaultTex);
+            if (!it) continue;
+            for (const auto& frame : lm.frames) {
+                for (const auto& r : ranges) {
+                    for (uint32_t v = r.first; v < r.first + r.second && !it->tiling; ++v) {
+                        if (!GDK_Internal_UVsInRange(frame[v].u, frame[v].v)) it->tiling = true;
+                    }
+                }
+                if (it->tiling) break;
+            }
+        } else if (master.TypeID == REVOLT) {
+            const PRM::PRM_Car& car = PRM::g_PRMStore[master.InternalIndex];
+            for (uint32_t tid : car.textures) ItemFor(tid);
+            for (int m = 0; m < (int)car.meshes.size(); ++m) {
+                for (const auto& poly : PRM::Internal_CarMesh(car, m).polygons) {
+                    if (poly.texture < 0 || poly.texture >= (int)car.textures.size()) continue;
+                    GDK_Internal_AtlasItem* it = ItemFor(car.textures[poly.texture]);
+                    if (!it) continue; // TPAGE failed to load
+                    for (int k = 0; k < ((poly.type & 1) ? 4 : 3); ++k) {
+                        if (!GDK_Internal_UVsInRange(poly.uv[k].u, poly.uv[k].v)) it->tiling = true;
+                    }
+                }
+            }
+        }
+        // STL and OBJ carry no UVs - nothing to pack
+    }
+
+    // 2. Read back the candidates
+    std::vector<GDK_Internal_AtlasItem*> candidates;
+    int tilingCount = 0;
+    for (auto& it : items) {
+        if (it.tiling) { tilingCount++; continue; }
+        if (!GDK_Internal_ReadTexture(it.tid, it.w, it.h, it.pixels)) continue;
+        if (it.w > maxSize / 2 || it.h > maxSize / 2) { it.pixels.clear(); continue; } // Already big - nothing to gain
+        it.cw = (it.w + padding * 2 + align - 1) / align * align;
+        it.ch = (it.h + padding * 2 + align - 1) / align * align;
+        candidates.push_back(&it);
+    }
+    if (candidates.empty()) {
+        printf("[ATLAS] Nothing to pack (%d tiling, %d total)\n", tilingCount, (int)items.size());
+        return -1;
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const GDK_Internal_AtlasItem* a, const GDK_Internal_AtlasItem* b) {
+        return (a->ch != b->ch) ? a->ch > b->ch : a->cw > b->cw;
+    });
+
+    // 3. Smallest square page that takes everything, else whatever fits at maxSize
+    int size = 256;
+    while (size < maxSize && GDK_Internal_PackAtlas(candidates, size) < (int)candidates.size()) size *= 2;
+    size = std::min(size, maxSize);
+    int placed = GDK_Internal_PackAtlas(candidates, size);
+    if (placed == 0) return -1;
+
+    // 4. Blit with edge-extended borders
+    std::vector<uint8_t> atlas((size_t)size * size * 4, 0);
+    size_t usedArea = 0;
+    for (auto* it : candidates) {
+        if (!it->packed) continue;
+        usedArea += (size_t)it->w * it->h;
+        for (int y = 0; y < it->ch; ++y) {
+            int sy = std::min(std::max(y - padding, 0), it->h - 1);
+            uint8_t* dst = &atlas[((size_t)(it->y + y) * size + it->x) * 4];
+            const uint8_t* row = &it->pixels[(size_t)sy * it->w * 4];
+            for (int x = 0; x < it->cw; ++x) {
+                int sx = std::min(std::max(x - padding, 0), it->w - 1);
+                memcpy(dst + x * 4, row + sx * 4, 4);
+            }
+        }
+        it->pixels.clear();
+        it->pixels.shrink_to_fit();
+    }
+
+    uint32_t tid;
+    glGenTextures(1, &tid);
+    glBindTexture(GL_TEXTURE_2D, tid);
+    size_t bytes;
+    if (GDK_Internal_WantBC(GDK_TEX_DEFAULT)) {
+        GDK_Internal_BCImage bc;
+        GDK_Internal_EncodeBC(atlas.data(), size, size, true, bc);
+        GDK_Internal_UploadBC(bc);
+        bytes = bc.data.size();
+    } else {
+        GDK_Internal_MipChain chain;
+        GDK_Internal_BuildMipChain(atlas.data(), size, size, GDK_MIP_DEFAULT, chain, maxLevel + 1);
+        GDK_Internal_UploadMipChain(chain);
+        bytes = chain.data.size();
+    }
+    GDK_Internal_ApplyTextureParams(GDK_TEX_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+
+    int slot = GDK_Internal_AllocTextureSlot("atlas:" + std::to_string(g_AtlasCount++), tid);
+    GDK_Internal_TextureEntry& entry = g_TextureInfo[slot];
+    entry.refs = 0; // One per holder below
+    entry.bytes = bytes;
+    g_TextureByName[tid] = slot;
+    g_TextureStats.bytes += bytes;
+
+    // 5. Point the holders at the atlas
+    int rewritten = 0;
+    for (int i = 0; i < count; ++i) {
+        int m = modelIdx[i];
+        if (m < 0 || (size_t)m >= gdk_models.size()) continue;
+        const GDK_Model_Master& master = gdk_models[m];
+
+        if (master.TypeID == MDL || master.TypeID == MD2 || master.TypeID == MD3) {
+            GDK_Legacy_Model& lm = g_ModelStore[master.InternalIndex];
+            auto ranges = GDK_Internal_AtlasDefaultRanges(lm);
+            auto f = byName.find((uint32_t)lm.defaultTex);
+            if (ranges.empty() || f == byName.end() || !items[f->second].packed) continue;
+            const GDK_Internal_AtlasItem& it = items[f->second];
+            for (auto& frame : lm.frames) {
+                for (const auto& r : ranges) {
+                    for (uint32_t v = r.first; v < r.first + r.second; ++v) GDK_Internal_AtlasRemap(it, padding, size, frame[v].u, frame[v].v);
+                }
+            }
+            GDK_Internal_GatherLODFrames(lm);
+            lm.vboFrame = -1; // Re-stream the remapped UVs
+
+            GDK_Internal_ReleaseTextureName((uint32_t)lm.defaultTex);
+            lm.defaultTex = tid;
+            entry.refs++;
+            rewritten++;
+        } else if (master.TypeID == REVOLT) {
+            PRM::PRM_Car& car = PRM::g_PRMStore[master.InternalIndex];
+
+            // New page list: atlas first, then whatever stayed separate
+            std::vector<uint32_t> pages = { tid };
+            std::vector<int> remap(car.textures.size(), -1);
+            std::vector<const GDK_Internal_AtlasItem*> source(car.textures.size(), nullptr);
+            for (size_t p = 0; p < car.textures.size(); ++p) {
+                auto f = byName.find(car.textures[p]);
+                if (f != byName.end() && items[f->second].packed) {
+                    remap[p] = 0;
+                    source[p] = &items[f->second];
+                } else {
+                    remap[p] = (int)pages.size();
+                    pages.push_back(car.textures[p]);
+                }
+            }
+            if (pages.size() == car.textures.size() + 1) continue; // Nothing of ours was packed
+
+            for (auto& ref : car.meshes) {
+                ref.lib = PRM::Internal_MakeMeshPrivate(ref.lib); // Other cars keep their UVs
+                PRM::PRM_Mesh& mesh = PRM::g_PRMMeshLib[ref.lib].mesh;
+                for (auto& poly : mesh.polygons) {
+                    if (poly.texture < 0 || poly.texture >= (int)car.textures.size()) continue;
+                    const GDK_Internal_AtlasItem* it = source[poly.texture];
+                    if (it) {
+                        for (int k = 0; k < 4; ++k) {
+                            // PRM v runs top-down (Drawn as 1 - v)
+                            float s = poly.uv[k].u, t = 1.0f - poly.uv[k].v;
+                            GDK_Internal_AtlasRemap(*it, padding, size, s, t);
+                            poly.uv[k].u = s; poly.uv[k].v = 1.0f - t;
+                        }
+                    }
+                    poly.texture = (short)remap[poly.texture];
+                }
+                PRM::Internal_CompileMesh(mesh);
+                mesh.Release(); // Re-uploaded on the next draw
+            }
+            for (size_t p = 0; p < car.textures.size(); ++p) {
+                if (source[p]) GDK_Internal_ReleaseTextureName(car.textures[p]);
+            }
+            car.textures = pages;
+            entry.refs++;
+            rewritten++;
+        }
+    }
+
+    if (entry.refs == 0) { entry.refs = 1; GDK_Internal_ReleaseTextureSlot(slot); return -1; }
+
+    printf("[ATLAS] %d textures -> %dx%d (%.0f%% used) for %d models | %d tiling, %d left separate | %.2fms\n",
+           placed, size, size, 100.0 * usedArea / ((double)size * size), rewritten, tilingCount,
+           (int)candidates.size() - placed, std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - t0).count());
+    return slot;
+}
+
+GDK_END_DECLS
+
+#endif // GDK_ATLAS_H
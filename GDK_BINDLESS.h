@@ -0,0 +1,170 @@
+#ifndef GDK_BINDLESS_H
+#define GDK_BINDLESS_H
+
+// --- BINDLESS TEXTURE RESIDENCY (AZDO / Mode 2) ---
+// Every texture slot gets a 64-bit handle (glGetTextureHandleARB) the first time a draw asks for it.
+// Handles live in an SSBO indexed by texture slot, so shaders pick textures by index with zero binds:
+//     GDK_TEXTURE(i) -> sampler2D
+// Residency is LRU under a VRAM budget. Slots that are not resident read the fallback handle instead,
+// because sampling a non-resident handle is undefined. Works by (slot, GL name) so it sits below the texture cache.
+
+#define GDK_BINDLESS_SSBO_BINDING 3
+#define GDK_BINDLESS_KEEP_FRAMES  2 // Never evict something a frame still in flight may sample
+
+struct GDK_Internal_BindlessEntry {
+    uint32_t glName = 0;   // Texture the handle was made from (Async swaps / mip streaming change it)
+    uint64_t handle = 0;
+    bool resident = false;
+    uint64_t lastUse = 0;  // Frame number
+    size_t bytes = 0;
+};
+
+struct GDK_BindlessStats {
+    uint32_t handles;      // Created so far (Live slots)
+    uint32_t resident;
+    uint64_t residentBytes;
+    uint32_t evictions;    // Total since boot
+};
+
+static std::vector<GDK_Internal_BindlessEntry> g_Bindless;   // Indexed by texture slot
+static std::vector<uint64_t> g_BindlessTable;                // CPU mirror of the SSBO
+static uint32_t g_BindlessSSBO = 0;
+static uint64_t* g_BindlessPtr = nullptr;                    // Persistent + coherent
+static size_t g_BindlessCapacity = 0;                        // Entries
+static uint32_t g_BindlessFallbackTex = 0;
+static uint64_t g_BindlessFallback = 0;
+static size_t g_BindlessBudget = (size_t)512 * 1024 * 1024;
+static GDK_BindlessStats g_BindlessStats = {};
+
+static const char* g_BindlessGLSL =
+    "#extension GL_ARB_bindless_texture : require\n"
+    "layout(std430, binding = 3) readonly buffer GDK_TextureTable { uvec2 gdk_Textures[]; };\n"
+    "#define GDK_TEXTURE(i) sampler2D(gdk_Textures[i])\n";
+
+static bool GDK_Internal_BindlessAvailable() {
+    return GDK::mode == GDK_MODE_AZDO && GLEW_ARB_bindless_texture;
+}
+
+static uint64_t GDK_Internal_BindlessFrame() {
+    return GDK::state ? (uint64_t)GDK::state->frameCount : 0;
+}
+
+static void GDK_Internal_BindlessInitFallback() {
+    if (g_BindlessFallback) return;
+    const uint8_t grey[4] = { 128, 128, 128, 255 };
+    glGenTextures(1, &g_BindlessFallbackTex);
+    glBindTexture(GL_TEXTURE_2D, g_BindlessFallbackTex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    g_BindlessFallback = glGetTextureHandleARB(g_BindlessFallbackTex);
+    glMakeTextureHandleResidentARB(g_BindlessFallback); // Always resident
+}
+
+// Grows the SSBO to hold 'slot' (Power of two, old contents re-written from the mirror)
+static void GDK_Internal_BindlessReserve(int slot) {
+    if ((size_t)slot < g_BindlessCapacity) return;
+    size_t cap = std::max<size_t>(64, g_BindlessCapacity);
+    while (cap <= (size_t)slot) cap *= 2;
+
+    if (g_BindlessSSBO) {
+        glUnmapNamedBuffer(g_BindlessSSBO);
+        glDeleteBuffers(1, &g_BindlessSSBO);
+    }
+    g_BindlessTable.resize(cap, g_BindlessFallback);
+
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &g_BindlessSSBO);
+    glNamedBufferStorage(g_BindlessSSBO, cap * sizeof(uint64_t), g_BindlessTable.data(), flags);
+    g_BindlessPtr = (uint64_t*)glMapNamedBufferRange(g_BindlessSSBO, 0, cap * sizeof(uint64_t), flags);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, GDK_BINDLESS_SSBO_BINDING, g_BindlessSSBO);
+    g_BindlessCapacity = cap;
+}
+
+static void GDK_Internal_BindlessWrite(int slot, uint64_t handle) {
+    g_BindlessTable[slot] = handle;
+    if (g_BindlessPtr) g_BindlessPtr[slot] = handle;
+}
+
+static void GDK_Internal_BindlessEvict(int slot) {
+    GDK_Internal_BindlessEntry& e = g_Bindless[slot];
+    if (!e.resident) return;
+    glMakeTextureHandleNonResidentARB(e.handle);
+    e.resident = false;
+    g_BindlessStats.resident--;
+    g_BindlessStats.residentBytes -= e.bytes;
+    GDK_Internal_BindlessWrite(slot, g_BindlessFallback);
+}
+
+// Drops least-recently-used handles until 'incoming' more bytes fit in the budget
+static void GDK_Internal_BindlessMakeRoom(size_t incoming) {
+    uint64_t frame = GDK_Internal_BindlessFrame();
+    while (g_BindlessStats.residentBytes + incoming > g_BindlessBudget) {
+        int victim = -1;
+        for (int i = 0; i < (int)g_Bindless.size(); ++i) {
+            const GDK_Internal_BindlessEntry& e = g_Bindless[i];
+            if (!e.resident || e.lastUse + GDK_BINDLESS_KEEP_FRAMES > frame) continue;
+            if (victim < 0 || e.lastUse < g_Bindless[victim].lastUse) victim = i;
+        }
+        if (victim < 0) return; // Everything is in use - go over budget rather than sample garbage
+        GDK_Internal_BindlessEvict(victim);
+        g_BindlessStats.evictions++;
+    }
+}
+
+// Makes 'slot' resident and returns its handle (0 if bindless is unavailable or glName is 0)
+static uint64_t GDK_Internal_BindlessTouch(int slot, uint32_t glName, size_t bytes) {
+    if (slot < 0 || glName == 0 || !GDK_Internal_BindlessAvailable()) return 0;
+    GDK_Internal_BindlessInitFallback();
+    GDK_Internal_BindlessReserve(slot);
+    if ((size_t)slot >= g_Bindless.size()) g_Bindless.resize(slot + 1);
+
+    GDK_Internal_BindlessEntry& e = g_Bindless[slot];
+    if (e.glName != glName) {
+        // Slot now points at a different texture - the old handle dies with its texture
+        GDK_Internal_BindlessEvict(slot);
+        if (!e.handle) g_BindlessStats.handles++;
+        e.glName = glName;
+        e.handle = glGetTextureHandleARB(glName); // Freezes the texture's sampler state
+    }
+    e.bytes = bytes;
+    e.lastUse = GDK_Internal_BindlessFrame();
+
+    if (!e.resident) {
+        GDK_Internal_BindlessMakeRoom(bytes);
+        glMakeTextureHandleResidentARB(e.handle);
+        e.resident = true;
+        g_BindlessStats.resident++;
+        g_BindlessStats.residentBytes += bytes;
+        GDK_Internal_BindlessWrite(slot, e.handle);
+    }
+    return e.handle;
+}
+
+// Texture slot freed - must run before the GL texture is deleted
+static void GDK_Internal_BindlessForget(int slot) {
+    if (slot < 0 || (size_t)slot >= g_Bindless.size()) return;
+    GDK_Internal_BindlessEvict(slot);
+    if (g_Bindless[slot].handle) g_BindlessStats.handles--;
+    g_Bindless[slot] = GDK_Internal_BindlessEntry();
+}
+
+GDK_BEGIN_DECLS
+
+// Resident VRAM cap in MB (Default 512)
+GDK_API void GDK_Bindless_SetBudget(int mb) {
+    g_BindlessBudget = (size_t)std::max(16, mb) * 1024 * 1024;
+}
+
+GDK_API void GDK_Bindless_GetStats(GDK_BindlessStats* out) {
+    if (out) *out = g_BindlessStats;
+}
+
+// Paste after #version in AZDO shaders: declares the handle table and GDK_TEXTURE(i)
+GDK_API const char* GDK_Bindless_GLSL() {
+    return g_BindlessGLSL;
+}
+
+GDK_END_DECLS
+
+#endif // GDK_BINDLESS_H
@@ -0,0 +1,418 @@
+#ifndef GDK_IMAGE_H
+#define GDK_IMAGE_H
+
+// --- IMAGE CONVERSION ---
+// Shared CPU-side pixel work for the texture loaders:
+//   - 8-bit palette -> RGBA through a 256 x uint32 LUT (AVX2 gathers 8 pixels at a time)
+//   - PCX RLE decoder that writes scanlines bottom-up, so no flip pass is needed for GL
+//   - Mip chain generator (Linear-light filtering, alpha coverage kept, any size down to 1x1)
+// No GL in here - everything is safe on a worker thread.
+
+// 768 byte RGB palette -> packed RGBA LUT (Memory order R,G,B,A)
+static void GDK_Internal_BuildPaletteLUT(const uint8_t* pal768, uint32_t lut[256]) {
+    for (int i = 0; i < 256; ++i) {
+        uint8_t px[4] = { pal768[i * 3], pal768[i * 3 + 1], pal768[i * 3 + 2], 255 };
+        memcpy(&lut[i], px, 4);
+    }
+}
+
+// n palette indices -> n RGBA pixels
+static void GDK_Internal_ExpandPalette(const uint8_t* idx, size_t n, const uint32_t lut[256], uint8_t* rgba) {
+    size_t i = 0;
+#ifdef GDK_SIMD_AVX2
+    for (; i + 8 <= n; i += 8) {
+        __m256i ids = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(idx + i)));
+        __m256i px = _mm256_i32gather_epi32((const int*)lut, ids, 4);
+        _mm256_storeu_si256((__m256i*)(rgba + i * 4), px);
+    }
+#endif
+    uint32_t* out = (uint32_t*)rgba; // Scalar path is already one load + one store per pixel
+    for (; i < n; ++i) memcpy(out + i, &lut[idx[i]], 4);
+}
+
+// --- PCX ---
+#pragma pack(push, 1)
+struct GDK_PCX_Header {
+    uint8_t manufacturer, version, encoding, bitsPerPixel;
+    uint16_t xMin, yMin, xMax, yMax, hDpi, vDpi;
+    uint8_t egaPalette[48];
+    uint8_t reserved, planes;
+    uint16_t bytesPerLine, paletteInfo, hScreen, vScreen;
+    uint8_t filler[54];
+};
+#pragma pack(pop)
+
+// Decodes 8-bit paletted (1 plane) and 24/32-bit (3/4 planes) PCX straight into bottom-up RGBA.
+// 'out' is malloc'd. Returns false for anything else (1/2/4-bit EGA) so the caller can fall back.
+static bool GDK_Internal_DecodePCX(const uint8_t* data, size_t size, int& w, int& h, uint8_t*& out) {
+    out = nullptr;
+    if (size < sizeof(GDK_PCX_Header)) return false;
+    GDK_PCX_Header hdr;
+    memcpy(&hdr, data, sizeof(hdr));
+    if (hdr.manufacturer != 0x0A || hdr.encoding != 1 || hdr.bitsPerPixel != 8) return false;
+    if (hdr.planes != 1 && hdr.planes != 3 && hdr.planes != 4) return false;
+
+    w = hdr.xMax - hdr.xMin + 1;
+    h = hdr.yMax - hdr.yMin + 1;
+    int bpl = hdr.bytesPerLine;
+    if (w <= 0 || h <= 0 || bpl < w) return false;
+
+    uint32_t lut[256];
+    if (hdr.planes == 1) {
+        // VGA palette lives in the last 769 bytes, tagged 0x0C
+        if (size < sizeof(hdr) + 769 || data[size - 769] != 0x0C) return false;
+        GDK_Internal_BuildPaletteLUT(data + size - 768, lut);
+    }
+
+    out = (uint8_t*)malloc((size_t)w * h * 4);
+    if (!out) return false;
+
+    const uint8_t* src = data + sizeof(hdr);
+    const uint8_t* end = data + size - (hdr.planes == 1 ? 769 : 0);
+    size_t lineBytes = (size_t)bpl * hdr.planes;
+    std::vector<uint8_t> line(lineBytes);
+    int run = 0; uint8_t runVal = 0; // RLE runs may cross scanlines
+
+    for (int y = 0; y < h; ++y) {
+        for (size_t x = 0; x < lineBytes; ) {
+            if (run == 0) {
+                if (src >= end) { free(out); out = nullptr; return false; }
+                uint8_t c = *src++;
+                if ((c & 0xC0) == 0xC0) {
+                    run = c & 0x3F;
+                    if (src >= end) { free(out); out = nullptr; return false; }
+                    runVal = *src++;
+                } else {
+                    run = 1; runVal = c;
+                }
+            }
+            size_t take = std::min((size_t)run, lineBytes - x);
+            memset(&line[x], runVal, take);
+            x += take; run -= (int)take;
+        }
+
+        // Top-down file row y -> bottom-up GL row
+        uint8_t* dst = out + (size_t)(h - 1 - y) * w * 4;
+        if (hdr.planes == 1) {
+            GDK_Internal_ExpandPalette(line.data(), w, lut, dst);
+        } else {
+            const uint8_t* r = &line[0]; const uint8_t* g = &line[bpl]; const uint8_t* b = &line[bpl * 2];
+            const uint8_t* a = (hdr.planes == 4) ? &line[bpl * 3] : nullptr;
+            for (int x = 0; x < w; ++x) {
+                dst[x * 4] = r[x]; dst[x * 4 + 1] = g[x]; dst[x * 4 + 2] = b[x]; dst[x * 4 + 3] = a ? a[x] : 255;
+            }
+        }
+    }
+    return true;
+}
+
+// --- MIP CHAIN ---
+// Each level is filtered from the previous one in float, linear light (Colour channels go through the
+// sRGB curve both ways), so dark/bright texel pairs no longer average too dark. NPOT sizes use the
+// 3-tap polyphase box on odd axes (Every source texel counts exactly once), so Quake's 296x194 skins
+// mip straight down without a rescale. Levels are sized floor(n/2) like GL expects.
+// Alpha-tested textures keep their alpha-test coverage per level (Castano: scale alpha until the fraction
+// of texels above the cutoff matches level 0), otherwise foliage/fences thin out and vanish with distance.
+enum GDK_Internal_MipFlags {
+    GDK_MIP_LINEAR        = 0,      // Plain data (Normal maps, masks)
+    GDK_MIP_SRGB          = 1 << 0, // RGB is sRGB-encoded colour
+    GDK_MIP_COVERAGE      = 1 << 1, // Preserve alpha-test coverage (Cutoff GDK_MIP_ALPHA_REF)
+    GDK_MIP_DEFAULT       = GDK_MIP_SRGB | GDK_MIP_COVERAGE
+};
+
+#define GDK_MIP_ALPHA_REF 0.5f
+
+struct GDK_Internal_MipChain {
+    int w = 0, h = 0;
+    std::vector<uint8_t> data;   // RGBA8, all levels back to back (Level 0 = the source)
+    std::vector<size_t> offsets; // Start of each level in 'data'
+
+    int Levels() const { return (int)offsets.size(); }
+    size_t LevelSize(int l) const { return ((l + 1 < Levels()) ? offsets[l + 1] : data.size()) - offsets[l]; }
+    const uint8_t* Level(int l) const { return data.data() + offsets[l]; }
+    void Dims(int l, int& lw, int& lh) const { lw = std::max(1, w >> l); lh = std::max(1, h >> l); }
+};
+
+// 8-bit -> linear float (index 0: sRGB decode, 1: /255)
+static const float* GDK_Internal_ToLinearLUT(bool srgb) {
+    static const std::vector<float> lut = []() {
+        std::vector<float> t(512);
+        for (int i = 0; i < 256; ++i) {
+            float c = i / 255.0f;
+            t[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+            t[256 + i] = c;
+        }
+        return t;
+    }();
+    return lut.data() + (srgb ? 0 : 256);
+}
+
+// Linear [0,1] in 4096 steps -> sRGB byte (12 bits keeps the dark end exact)
+static const uint8_t* GDK_Internal_FromLinearLUT() {
+    static const std::vector<uint8_t> lut = []() {
+        std::vector<uint8_t> t(4096);
+        for (int i = 0; i < 4096; ++i) {
+            float l = i / 4095.0f;
+            float c = (l <= 0.0031308f) ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+            t[i] = (uint8_t)std::min(255.0f, c * 255.0f + 0.5f);
+        }
+        return t;
+    }();
+    return lut.data();
+}
+
+// One axis of the n -> max(1, n/2) filter: up to 3 source texels per destination texel
+struct GDK_Internal_MipTaps { int first, count; float wt[3]; };
+
+static void GDK_Internal_BuildMipTaps(int n, std::vector<GDK_Internal_MipTaps>& taps) {
+    int m = std::max(1, n / 2);
+    taps.resize(m);
+    for (int x = 0; x < m; ++x) {
+        GDK_Internal_MipTaps& t = taps[x];
+        t.first = std::min(2 * x, n - 1);
+        if (n == 1)          { t.count = 1; t.wt[0] = 1.0f; }
+        else if (!(n & 1))   { t.count = 2; t.wt[0] = t.wt[1] = 0.5f; }
+        else {
+            float d = 1.0f / (2 * m + 1);
+            t.count = 3; t.wt[0] = (m - x) * d; t.wt[1] = m * d; t.wt[2] = (x + 1) * d;
+        }
+    }
+}
+
+// 4-channel float pixel ops (One SSE register per texel)
+#ifdef GDK_SIMD_SSE2
+typedef __m128 GDK_Internal_Px;
+static inline GDK_Internal_Px GDK_Internal_PxZero() { return _mm_setzero_ps(); }
+static inline GDK_Internal_Px GDK_Internal_PxLoad(const float* p, const float*) { return _mm_loadu_ps(p); }
+static inline GDK_Internal_Px GDK_Internal_PxLoad(const uint8_t* p, const float* lut) {
+    return _mm_set_ps(p[3] * (1.0f / 255.0f), lut[p[2]], lut[p[1]], lut[p[0]]);
+}
+static inline GDK_Internal_Px GDK_Internal_PxMadd(GDK_Internal_Px acc, GDK_Internal_Px p, float w) {
+    return _mm_add_ps(acc, _mm_mul_ps(p, _mm_set1_ps(w)));
+}
+static inline void GDK_Internal_PxStore(float* dst, GDK_Internal_Px p) { _mm_storeu_ps(dst, p); }
+#else
+struct GDK_Internal_Px { float v[4]; };
+static inline GDK_Internal_Px GDK_Internal_PxZero() { return { { 0, 0, 0, 0 } }; }
+static inline GDK_Internal_Px GDK_Internal_PxLoad(const float* p, const float*) { return { { p[0], p[1], p[2], p[3] } }; }
+static inline GDK_Internal_Px GDK_Internal_PxLoad(const uint8_t* p, const float* lut) {
+    return { { lut[p[0]], lut[p[1]], lut[p[2]], p[3] * (1.0f / 255.0f) } };
+}
+static inline GDK_Internal_Px GDK_Internal_PxMadd(GDK_Internal_Px acc, GDK_Internal_Px p, float w) {
+    for (int c = 0; c < 4; ++c) acc.v[c] += p.v[c] * w;
+    return acc;
+}
+static inline void GDK_Internal_PxStore(float* dst, GDK_Internal_Px p) { memcpy(dst, p.v, 16); }
+#endif
+
+// src (sw x sh, float RGBA or 8-bit RGBA through 'lut') -> dst (max(1,sw/2) x max(1,sh/2) float RGBA)
+template <typename T>
+static void GDK_Internal_MipFilter(const T* src, int sw, int sh, const float* lut, float* dst) {
+    std::vector<GDK_Internal_MipTaps> tx, ty;
+    GDK_Internal_BuildMipTaps(sw, tx);
+    GDK_Internal_BuildMipTaps(sh, ty);
+    int dw = (int)tx.size();
+
+    GDK::Jobs::ParallelFor((int)ty.size(), std::max(1, 16384 / dw), [&](int y0, int y1) {
+        for (int y = y0; y < y1; ++y) {
+            const GDK_Internal_MipTaps& vy = ty[y];
+            for (int x = 0; x < dw; ++x) {
+                const GDK_Internal_MipTaps& vx = tx[x];
+                GDK_Internal_Px acc = GDK_Internal_PxZero();
+                for (int j = 0; j < vy.count; ++j) {
+                    const T* row = src + ((size_t)std::min(vy.first + j, sh - 1) * sw) * 4;
+                    GDK_Internal_Px r = GDK_Internal_PxZero();
+                    for (int i = 0; i < vx.count; ++i) {
+                        const T* p = row + (size_t)std::min(vx.first + i, sw - 1) * 4;
+                        r = GDK_Internal_PxMadd(r, GDK_Internal_PxLoad(p, lut), vx.wt[i]);
+                    }
+                    acc = GDK_Internal_PxMadd(acc, r, vy.wt[j]);
+                }
+                GDK_Internal_PxStore(dst + ((size_t)y * dw + x) * 4, acc);
+            }
+        }
+    });
+}
+
+// Fraction of alpha bytes above the cutoff once scaled (Rounded exactly as the scale is applied)
+static float GDK_Internal_AlphaCoverage(const uint32_t hist[256], size_t n, float scale) {
+    size_t above = 0;
+    for (int a = 0; a < 256; ++a) {
+        float v = std::min(255.0f, a * scale + 0.5f);
+        if ((int)v > GDK_MIP_ALPHA_REF * 255.0f) above += hist[a];
+    }
+    return n ? (float)above / n : 0.0f;
+}
+
+// Builds the chain from level 0 down to 1x1 (Or 'maxLevels' levels if > 0). Flags: GDK_Internal_MipFlags.
+static void GDK_Internal_BuildMipChain(const uint8_t* rgba, int w, int h, int flags, GDK_Internal_MipChain& out, int maxLevels = 0) {
+    out.w = w; out.h = h;
+    out.data.clear(); out.offsets.clear();
+    if (!rgba || w <= 0 || h <= 0) return;
+
+    int levels = 1;
+    for (int lw = w, lh = h; lw > 1 || lh > 1; lw = std::max(1, lw / 2), lh = std::max(1, lh / 2)) levels++;
+    if (maxLevels > 0) levels = std::min(levels, maxLevels);
+
+    size_t total = 0;
+    for (int l = 0; l < levels; ++l) {
+        out.offsets.push_back(total);
+        total += (size_t)std::max(1, w >> l) * std::max(1, h >> l) * 4;
+    }
+    out.data.resize(total);
+    memcpy(out.data.data(), rgba, (size_t)w * h * 4);
+
+    bool srgb = (flags & GDK_MIP_SRGB) != 0;
+    const float* toLinear = GDK_Internal_ToLinearLUT(srgb);
+    const uint8_t* fromLinear = GDK_Internal_FromLinearLUT();
+
+    // Coverage reference from level 0 (Skipped for opaque textures)
+    bool coverage = false;
+    float refCoverage = 0.0f;
+    if (flags & GDK_MIP_COVERAGE) {
+        uint32_t hist[256] = {};
+        size_t n = (size_t)w * h;
+        for (size_t i = 0; i < n; ++i) hist[rgba[i * 4 + 3]]++;
+        coverage = hist[255] != n && hist[0] != n;
+        refCoverage = GDK_Internal_AlphaCoverage(hist, n, 1.0f);
+    }
+
+    std::vector<float> cur, next;
+    int lw = w, lh = h;
+    for (int l = 1; l < levels; ++l) {
+        int nw = std::max(1, lw / 2), nh = std::max(1, lh / 2);
+        next.resize((size_t)nw * nh * 4);
+        if (l == 1) GDK_Internal_MipFilter(rgba, lw, lh, toLinear, next.data());
+        else GDK_Internal_MipFilter(cur.data(), lw, lh, nullptr, next.data());
+
+        uint8_t* dst = out.data.data() + out.offsets[l];
+        GDK::Jobs::ParallelFor(nh, std::max(1, 16384 / nw), [&](int y0, int y1) {
+            for (size_t i = (size_t)y0 * nw; i < (size_t)y1 * nw; ++i) {
+                const float* p = &next[i * 4];
+                for (int c = 0; c < 3; ++c) {
+                    float v = std::min(std::max(p[c], 0.0f), 1.0f);
+                    dst[i * 4 + c] = srgb ? fromLinear[(int)(v * 4095.0f + 0.5f)] : (uint8_t)(v * 255.0f + 0.5f);
+                }
+                dst[i * 4 + 3] = (uint8_t)(std::min(std::max(p[3], 0.0f), 1.0f) * 255.0f + 0.5f);
+            }
+        });
+
+        if (coverage) {
+            // Binary search the alpha scale on a histogram, then apply it to this level only
+            size_t n = (size_t)nw * nh;
+            uint32_t hist[256] = {};
+            for (size_t i = 0; i < n; ++i) hist[dst[i * 4 + 3]]++;
+            float lo = 0.0f, hi = 4.0f;
+            for (int it = 0; it < 12; ++it) {
+                float mid = 0.5f * (lo + hi);
+                if (GDK_Internal_AlphaCoverage(hist, n, mid) < refCoverage) lo = mid; else hi = mid;
+            }
+            // Coverage is a step function - take whichever side of the step lands closer
+            float scale = (std::fabs(GDK_Internal_AlphaCoverage(hist, n, lo) - refCoverage) <
+                           std::fabs(GDK_Internal_AlphaCoverage(hist, n, hi) - refCoverage)) ? lo : hi;
+            if (std::fabs(scale - 1.0f) > 1e-3f) {
+                for (size_t i = 0; i < n; ++i) dst[i * 4 + 3] = (uint8_t)std::min(255.0f, dst[i * 4 + 3] * scale + 0.5f);
+            }
+        }
+
+        cur.swap(next);
+        lw = nw; lh = nh;
+    }
+}
+
+GDK_BEGIN_DECLS
+
+// Times the PCX decode + palette expansion against the old paths (drpcx + row flip, scalar RGB loop)
+// on a real file and checks both produce the same pixels. Results go to stdout.
+GDK_API void GDK_Image_Benchmark(const char* pcxPath, int iterations) {
+    if (!pcxPath) return;
+    if (iterations < 1) iterations = 1;
+    GDK::Internal::MappedFile f;
+    if (!f.Open(pcxPath)) { printf("[IMAGE] Benchmark: cannot open %s\n", pcxPath); return; }
+    using Clock = std::chrono::high_resolution_clock;
+    auto Ms = [](Clock::time_point a) { return std::chrono::duration<double, std::milli>(Clock::now() - a).count(); };
+
+    // 1. Old decode: drpcx + manual vertical flip
+    int ow = 0, oh = 0, oc = 0;
+    uint8_t* ref = nullptr;
+    auto t = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        if (ref) drpcx_free(ref);
+        ref = drpcx_load_memory(f.data, f.size, DRPCX_FALSE, &ow, &oh, &oc, 4);
+        if (!ref) break;
+        int rowSize = ow * 4;
+        std::vector<uint8_t> tempRow(rowSize);
+        for (int y = 0; y < oh / 2; ++y) {
+            uint8_t* top = ref + (y * rowSize);
+            uint8_t* bottom = ref + ((oh - 1 - y) * rowSize);
+            memcpy(tempRow.data(), top, rowSize);
+            memcpy(top, bottom, rowSize);
+            memcpy(bottom, tempRow.data(), rowSize);
+        }
+    }
+    double oldMs = Ms(t) / iterations;
+
+    // 2. New decode
+    int nw = 0, nh = 0;
+    uint8_t* img = nullptr;
+    t = Clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        if (img) free(img);
+        if (!GDK_Internal_DecodePCX(f.data, f.size, nw, nh, img)) break;
+    }
+    double newMs = Ms(t) / iterations;
+
+    if (!img) printf("[IMAGE] %s: format not handled by the fast decoder (drpcx fallback) | drpcx %.3fms\n", pcxPath, oldMs);
+    else {
+        bool same = ref && ow == nw && oh == nh && memcmp(ref, img, (size_t)nw * nh * 4) == 0;
+        printf("[IMAGE] PCX %dx%d: drpcx+flip %.3fms | direct %.3fms (%.1fx) | pixels %s\n",
+               nw, nh, oldMs, newMs, newMs > 0 ? oldMs / newMs : 0.0, same ? "match" : "DIFFER");
+    }
+
+    // 3. Palette expansion on the file's own indices (8-bit PCX only): scalar RGB loop vs LUT/gather
+    GDK_PCX_Header hdr;
+    memcpy(&hdr, f.data, sizeof(hdr));
+    if (img && hdr.planes == 1) {
+        size_t n = (size_t)nw * nh;
+        std::vector<uint8_t> idx(n);
+        const uint8_t* pal = f.data + f.size - 768;
+        uint32_t lut[256];
+        GDK_Internal_BuildPaletteLUT(pal, lut);
+
+        // Recover the file's real index stream from the decoded pixels
+        std::unordered_map<uint32_t, uint8_t> reverse;
+        for (int i = 255; i >= 0; --i) reverse[lut[i]] = (uint8_t)i;
+        for (size_t i = 0; i < n; ++i) { uint32_t px; memcpy(&px, img + i * 4, 4); idx[i] = reverse[px]; }
+
+        std::vector<uint8_t> rgb(n * 3), rgba(n * 4);
+        t = Clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            for (size_t i = 0; i < n; i++) {
+                uint8_t id = idx[i];
+                rgb[i * 3 + 0] = pal[id * 3 + 0];
+                rgb[i * 3 + 1] = pal[id * 3 + 1];
+                rgb[i * 3 + 2] = pal[id * 3 + 2];
+            }
+        }
+        double scalarMs = Ms(t) / iterations;
+
+        t = Clock::now();
+        for (int it = 0; it < iterations; ++it) GDK_Internal_ExpandPalette(idx.data(), n, lut, rgba.data());
+        double lutMs = Ms(t) / iterations;
+
+        printf("[IMAGE] Palette %zu px: scalar RGB %.3fms | LUT %s %.3fms (%.1fx)\n", n, scalarMs,
+#ifdef GDK_SIMD_AVX2
+               "AVX2",
+#else
+               "scalar",
+#endif
+               lutMs, lutMs > 0 ? scalarMs / lutMs : 0.0);
+    }
+
+    if (ref) drpcx_free(ref);
+    if (img) free(img);
+}
+
+GDK_END_DECLS
+
+#endif // GDK_IMAGE_H
@@ -0,0 +1,97 @@
+#ifndef GDK_JOBS_H
+#define GDK_JOBS_H
+
+// --- SHARED WORKER POOL ---
+// One pool for the whole engine. Workers NEVER touch GL - anything that needs the
+// context is handed back to the main thread (see the terrain/texture streamers).
+// The pool is intentionally leaked: joining threads from a DLL detach deadlocks on Windows.
+
+namespace GDK {
+    namespace Jobs {
+
+        struct Pool {
+            std::vector<std::thread> workers;
+            std::deque<std::function<void()>> queue;
+            std::mutex lock;
+            std::condition_variable wake;
+
+            void Start(int count) {
+                for (int i = 0; i < count; ++i) {
+                    workers.emplace_back([this]() {
+                        for (;;) {
+                            std::function<void()> job;
+                            {
+                                std::unique_lock<std::mutex> l(lock);
+                                wake.wait(l, [this]() { return !queue.empty(); });
+                                job = std::move(queue.front());
+                                queue.pop_front();
+                            }
+                            job();
+                        }
+                    });
+                }
+            }
+
+            void Push(std::function<void()> job) {
+                { std::lock_guard<std::mutex> l(lock); queue.push_back(std::move(job)); }
+                wake.notify_one();
+            }
+
+            // Lets a waiting thread help instead of spinning (also makes nested ParallelFor safe)
+            bool RunOne() {
+                std::function<void()> job;
+                {
+                    std::lock_guard<std::mutex> l(lock);
+                    if (queue.empty()) return false;
+                    job = std::move(queue.front());
+                    queue.pop_front();
+                }
+                job();
+                return true;
+            }
+        };
+
+        static Pool* g_Pool = nullptr;
+
+        static Pool& Get() {
+            if (!g_Pool) {
+                g_Pool = new Pool();
+                int hw = (int)std::thread::hardware_concurrency();
+                g_Pool->Start(hw > 1 ? hw - 1 : 1); // Main thread is the extra worker
+            }
+            return *g_Pool;
+        }
+
+        static int WorkerCount() { return (int)Get().workers.size(); }
+
+        // Fire and forget
+        static void Push(std::function<void()> job) { Get().Push(std::move(job)); }
+
+        // Splits [0, count) into bands of at least 'grain' items and blocks until all are done.
+        // The calling thread runs the first band itself.
+        static void ParallelFor(int count, int grain, const std::function<void(int, int)>& fn) {
+            if (count <= 0) return;
+            if (grain < 1) grain = 1;
+            Pool& p = Get();
+
+            int bands = std::min((count + grain - 1) / grain, (int)p.workers.size() + 1);
+            if (bands <= 1) { fn(0, count); return; }
+
+            int per = (count + bands - 1) / bands;
+            std::atomic<int> remaining(0);
+            for (int b = 1; b < bands; ++b) {
+                int s = b * per, e = std::min(count, s + per);
+                if (s >= e) break;
+                remaining++;
+                p.Push([&fn, &remaining, s, e]() { fn(s, e); remaining--; });
+            }
+            fn(0, std::min(count, per));
+
+            while (remaining.load() > 0) {
+                if (!p.RunOne()) std::this_thread::yield();
+            }
+        }
+    }
+}
+
+#endif // GDK_JOBS_H
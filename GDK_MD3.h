@@ -1,115 +1,231 @@
-#ifndef GDK_MD3_H
-#define GDK_MD3_H
-
-
-// Helper function to decompress MD3 normal shorts
-static glm::vec3 DecompressMD3Normal(int16_t normal) {
-    float lat = (float)((normal >> 8) & 0xFF) * (2.0f * glm::pi<float>()) / 255.0f;
-    float lng = (float)((normal >> 0) & 0xFF) * (2.0f * glm::pi<float>()) / 255.0f;
-    
-    glm::vec3 out;
-    out.x = glm::cos(lat) * glm::sin(lng);
-    out.y = glm::sin(lat) * glm::sin(lng);
-    out.z = glm::cos(lng);
-    return out;
-}
-static bool GDK_Internal_LoadMD3(const char* mPath, GDK_Legacy_Model& model) {
-    std::ifstream file(mPath, std::ios::binary);
-    if (!file.is_open()) return false;
-
-    // Ensure we start at the beginning since the router already peeked at the magic
-    file.seekg(0, std::ios::beg);
-
-    MD3_Header h;
-    file.read((char*)&h, sizeof(MD3_Header));
-
-    // Basic safety check for version/ident
-    if (h.version != 15) { file.close(); return false; }
-
-    // 1. Critical Meta-Data
-    model.type = MD3;
-    model.numFrames = h.num_frames;
-    model.numTags = h.num_tags;
-    model.numTris = 0;
-    model.numVerts = 0;
-    
-    // Pre-size frames vector to prevent crashes during push_back
-    model.frames.assign(h.num_frames, std::vector<GDK_Legacy_Vert>());
-
-    // 2. Initialize Hierarchy
-    if (!model.hierarchy) {
-        model.hierarchy = new GDK_MD3_Hierarchy();
-    }
-    model.hierarchy->tagFrames.resize(h.num_frames);
-    
-    // Load Tags
-    file.seekg(h.offset_tags);
-    for (int i = 0; i < h.num_frames; ++i) {
-        model.hierarchy->tagFrames[i].resize(h.num_tags);
-        for (int j = 0; j < h.num_tags; ++j) {
-            MD3_Tag rawTag;
-            file.read((char*)&rawTag, sizeof(MD3_Tag));
-            model.hierarchy->tagFrames[i][j].name = rawTag.name;
-            model.hierarchy->tagFrames[i][j].pos  = rawTag.pos;
-            model.hierarchy->tagFrames[i][j].axis = rawTag.axis;
-        }
-    }
-
-    // 3. Surface Unrolling
-    int surfaceOffset = h.offset_surfaces;
-    for (int s = 0; s < h.num_surfaces; ++s) {
-        file.seekg(surfaceOffset);
-        MD3_Surface surf;
-        file.read((char*)&surf, sizeof(MD3_Surface));
-
-        // Load Buffers
-        std::vector<MD3_Triangle> sTris(surf.num_tris);
-        file.seekg(surfaceOffset + surf.offset_tris);
-        file.read((char*)sTris.data(), surf.num_tris * sizeof(MD3_Triangle));
-
-        std::vector<MD3_TexCoord> sUVs(surf.num_verts);
-        file.seekg(surfaceOffset + surf.offset_st);
-        file.read((char*)sUVs.data(), surf.num_verts * sizeof(MD3_TexCoord));
-
-        std::vector<MD3_Vertex> sVerts(surf.num_verts * surf.num_frames);
-        file.seekg(surfaceOffset + surf.offset_xyznormal);
-        file.read((char*)sVerts.data(), sVerts.size() * sizeof(MD3_Vertex));
-
-        // Unroll: 1 unique vertex per triangle corner
-        for (int t = 0; t < surf.num_tris; ++t) {
-            // Note: Swapped to i=2 to 0 if your model is inside-out (Winding Order)
-            for (int i = 0; i < 3; ++i) { 
-                int vIdx = sTris[t].indexes[i];
-
-                model.indices.push_back(model.numVerts);
-
-                for (int f = 0; f < h.num_frames; ++f) {
-                    MD3_Vertex& vIn = sVerts[f * surf.num_verts + vIdx];
-                    GDK_Legacy_Vert vOut;
-
-                    vOut.x = vIn.x / 64.0f;
-                    vOut.y = vIn.y / 64.0f;
-                    vOut.z = vIn.z / 64.0f;
-                    vOut.u = sUVs[vIdx].u;
-                    vOut.v = sUVs[vIdx].v;
-
-                    glm::vec3 n = DecompressMD3Normal(vIn.normal);
-                    vOut.nx = n.x; vOut.ny = n.y; vOut.nz = n.z;
-
-                    model.frames[f].push_back(vOut);
-                }
-                model.numVerts++;
-            }
-        }
-        model.numTris += surf.num_tris;
-        surfaceOffset += surf.offset_end;
-    }
-
-    file.close();
-    return true;
-}
-
-
-
-
+#ifndef GDK_MD3_H
+#define GDK_MD3_H
+
+
+// MD3 normals are packed lat/lng bytes - all 65536 combinations decoded once (768 KB)
+static const glm::vec3* GDK_Internal_MD3NormalLUT() {
+    static const std::vector<glm::vec3> lut = []() {
+        std::vector<glm::vec3> t(65536);
+        for (int lat = 0; lat < 256; ++lat) {
+            float a = (float)lat * (2.0f * glm::pi<float>()) / 255.0f;
+            for (int lng = 0; lng < 256; ++lng) {
+                float b = (float)lng * (2.0f * glm::pi<float>()) / 255.0f;
+                t[(lat << 8) | lng] = glm::vec3(glm::cos(a) * glm::sin(b), glm::sin(a) * glm::sin(b), glm::cos(b));
+            }
+        }
+        return t;
+    }();
+    return lut.data();
+}
+
+// Helper function to decompress MD3 normal shorts
+static glm::vec3 DecompressMD3Normal(int16_t normal) {
+    return GDK_Internal_MD3NormalLUT()[(uint16_t)normal];
+}
+
+// --- SURFACE MATERIALS ---
+// Quake 3 paths are relative to the game root ("models/players/sarge/band.tga") and often name a .tga
+// that shipped as .jpg, so try the path as given and next to the model, with the usual extensions.
+static uint32_t GDK_Internal_MD3LoadSurfaceTexture(const std::string& modelDir, std::string ref) {
+    if (ref.empty()) return 0;
+    std::replace(ref.begin(), ref.end(), '\\', '/');
+    size_t slash = ref.find_last_of('/');
+    std::string file = (slash == std::string::npos) ? ref : ref.substr(slash + 1);
+
+    const char* exts[] = { "", ".tga", ".jpg", ".png", ".pcx" };
+    const std::string bases[] = { ref, modelDir + file };
+    for (const std::string& base : bases) {
+        size_t dot = base.find_last_of('.');
+        std::string stem = (dot != std::string::npos && dot > base.find_last_of('/') + 1) ? base.substr(0, dot) : base;
+        for (const char* ext : exts) {
+            std::string path = *ext ? stem + ext : base;
+            std::ifstream probe(path, std::ios::binary);
+            if (!probe) continue;
+            probe.close();
+            uint32_t tid = GDK_Internal_AcquireTexture(path.c_str());
+            if (tid) return tid;
+        }
+    }
+    return 0;
+}
+
+// Resolves each surface's texture from "<model>_default.skin" (or "<model>.skin"), falling back to the
+// shader path inside the .md3, then sorts surfaces by texture so GDK_Model_Draw binds each material once.
+static void GDK_Internal_MD3BindSurfaces(const char* mPath, GDK_Legacy_Model& model) {
+    std::string path = mPath;
+    std::replace(path.begin(), path.end(), '\\', '/');
+    size_t slash = path.find_last_of('/');
+    std::string dir = (slash == std::string::npos) ? "" : path.substr(0, slash + 1);
+    size_t dot = path.find_last_of('.');
+    std::string stem = (dot != std::string::npos && (slash == std::string::npos || dot > slash)) ? path.substr(0, dot) : path;
+
+    // "surface,path" per line; tags appear with an empty path
+    std::map<std::string, std::string> skin;
+    std::ifstream sf(stem + "_default.skin");
+    if (!sf) sf.open(stem + ".skin");
+    std::string line;
+    while (std::getline(sf, line)) {
+        size_t comma = line.find(',');
+        if (comma == std::string::npos) continue;
+        std::string name = line.substr(0, comma), tex = line.substr(comma + 1);
+        auto trim = [](std::string& v) {
+            v.erase(0, v.find_first_not_of(" \t\r\n\""));
+            size_t e = v.find_last_not_of(" \t\r\n\"");
+            v.erase(e == std::string::npos ? 0 : e + 1);
+        };
+        trim(name); trim(tex);
+        if (name.empty() || tex.empty()) continue;
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        skin[name] = tex;
+    }
+
+    for (auto& s : model.surfaces) {
+        std::string key = s.name;
+        std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+        auto it = skin.find(key);
+        if (it != skin.end()) s.texture = GDK_Internal_MD3LoadSurfaceTexture(dir, it->second);
+        if (!s.texture) s.texture = GDK_Internal_MD3LoadSurfaceTexture(dir, s.shader);
+    }
+    std::stable_sort(model.surfaces.begin(), model.surfaces.end(),
+                     [](const GDK_Legacy_Surface& a, const GDK_Legacy_Surface& b) { return a.texture < b.texture; });
+}
+
+// Tag 'tagId' between two frames, as a model-space matrix (Columns = tag axes, translation = origin).
+// Position is lerped and each axis lerped + renormalized, as Quake 3 does.
+static bool GDK_Internal_MD3TagMatrix(const GDK_Legacy_Model& m, int tagId, int frameA, int frameB, float lerp, glm::mat4& out) {
+    out = glm::mat4(1.0f);
+    if (!m.hierarchy || m.hierarchy->tagFrames.empty()) return false;
+    int slot = m.hierarchy->Slot(tagId);
+    if (slot < 0) return false;
+
+    int n = (int)m.hierarchy->tagFrames.size();
+    frameA = (frameA < 0) ? 0 : frameA % n;
+    frameB = (frameB < 0) ? 0 : frameB % n;
+    const GDK_MD3_Tag_Data& a = m.hierarchy->tagFrames[frameA][slot];
+    const GDK_MD3_Tag_Data& b = m.hierarchy->tagFrames[frameB][slot];
+
+    for (int i = 0; i < 3; ++i) {
+        glm::vec3 axis = (frameA == frameB) ? a.axis[i] : glm::normalize(glm::mix(a.axis[i], b.axis[i], lerp));
+        out[i] = glm::vec4(axis.x, axis.y, axis.z, 0.0f);
+    }
+    glm::vec3 pos = glm::mix(a.pos, b.pos, lerp);
+    out[3] = glm::vec4(pos.x, pos.y, pos.z, 1.0f);
+    return true;
+}
+
+static bool GDK_Internal_LoadMD3(const char* mPath, GDK_Legacy_Model& model) {
+    std::ifstream file(mPath, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    // Ensure we start at the beginning since the router already peeked at the magic
+    file.seekg(0, std::ios::beg);
+
+    MD3_Header h;
+    file.read((char*)&h, sizeof(MD3_Header));
+
+    // Basic safety check for version/ident
+    if (h.version != 15) { file.close(); return false; }
+
+    // 1. Critical Meta-Data
+    model.type = MD3;
+    model.numFrames = h.num_frames;
+    model.numTags = h.num_tags;
+    model.numTris = 0;
+    model.numVerts = 0;
+    
+    // Pre-size frames vector to prevent crashes during push_back
+    model.frames.assign(h.num_frames, std::vector<GDK_Legacy_Vert>());
+
+    // 2. Initialize Hierarchy
+    if (!model.hierarchy) {
+        model.hierarchy = new GDK_MD3_Hierarchy();
+    }
+    model.hierarchy->tagFrames.resize(h.num_frames);
+    model.hierarchy->tagIds.assign(h.num_tags, -1);
+    
+    // Load Tags (Every frame repeats the names in the same order - intern them once)
+    file.seekg(h.offset_tags);
+    for (int i = 0; i < h.num_frames; ++i) {
+        model.hierarchy->tagFrames[i].resize(h.num_tags);
+        for (int j = 0; j < h.num_tags; ++j) {
+            MD3_Tag rawTag;
+            file.read((char*)&rawTag, sizeof(MD3_Tag));
+            if (i == 0) model.hierarchy->tagIds[j] = GDK_Internal_InternTag(std::string(rawTag.name, strnlen(rawTag.name, sizeof(rawTag.name))));
+            model.hierarchy->tagFrames[i][j].pos  = rawTag.pos;
+            model.hierarchy->tagFrames[i][j].axis = rawTag.axis;
+        }
+    }
+
+    // 3. Surface Unrolling (Each surface keeps its own range of the unrolled arrays)
+    const glm::vec3* normalLUT = GDK_Internal_MD3NormalLUT();
+    model.surfaces.clear();
+    int surfaceOffset = h.offset_surfaces;
+    for (int s = 0; s < h.num_surfaces; ++s) {
+        file.seekg(surfaceOffset);
+        MD3_Surface surf;
+        file.read((char*)&surf, sizeof(MD3_Surface));
+
+        GDK_Legacy_Surface range;
+        range.name = std::string(surf.name, strnlen(surf.name, sizeof(surf.name)));
+        range.firstVert = (uint32_t)model.numVerts;
+        range.numVerts = (uint32_t)surf.num_tris * 3;
+        if (surf.num_shaders > 0) {
+            MD3_Shader shader;
+            file.seekg(surfaceOffset + surf.offset_shaders);
+            file.read((char*)&shader, sizeof(MD3_Shader));
+            range.shader = std::string(shader.name, strnlen(shader.name, sizeof(shader.name)));
+        }
+        model.surfaces.push_back(range);
+
+        // Load Buffers
+        std::vector<MD3_Triangle> sTris(surf.num_tris);
+        file.seekg(surfaceOffset + surf.offset_tris);
+        file.read((char*)sTris.data(), surf.num_tris * sizeof(MD3_Triangle));
+
+        std::vector<MD3_TexCoord> sUVs(surf.num_verts);
+        file.seekg(surfaceOffset + surf.offset_st);
+        file.read((char*)sUVs.data(), surf.num_verts * sizeof(MD3_TexCoord));
+
+        std::vector<MD3_Vertex> sVerts(surf.num_verts * surf.num_frames);
+        file.seekg(surfaceOffset + surf.offset_xyznormal);
+        file.read((char*)sVerts.data(), sVerts.size() * sizeof(MD3_Vertex));
+
+        // Unroll: 1 unique vertex per triangle corner
+        for (int t = 0; t < surf.num_tris; ++t) {
+            // Note: Swapped to i=2 to 0 if your model is inside-out (Winding Order)
+            for (int i = 0; i < 3; ++i) { 
+                int vIdx = sTris[t].indexes[i];
+
+                model.indices.push_back(model.numVerts);
+
+                for (int f = 0; f < h.num_frames; ++f) {
+                    MD3_Vertex& vIn = sVerts[f * surf.num_verts + vIdx];
+                    GDK_Legacy_Vert vOut;
+
+                    vOut.x = vIn.x / 64.0f;
+                    vOut.y = vIn.y / 64.0f;
+                    vOut.z = vIn.z / 64.0f;
+                    vOut.u = sUVs[vIdx].u;
+                    vOut.v = sUVs[vIdx].v;
+
+                    const glm::vec3& n = normalLUT[(uint16_t)vIn.normal];
+                    vOut.nx = n.x; vOut.ny = n.y; vOut.nz = n.z;
+
+                    model.frames[f].push_back(vOut);
+                }
+                model.numVerts++;
+            }
+        }
+        model.numTris += surf.num_tris;
+        surfaceOffset += surf.offset_end;
+    }
+
+    file.close();
+    GDK_Internal_MD3BindSurfaces(mPath, model);
+    return true;
+}
+
+
+
+
 #endif // GDK_MD3_H
\ No newline at end of file
@@ -0,0 +1,261 @@
+#ifndef GDK_MD3_ACTOR_H
+#define GDK_MD3_ACTOR_H
+
+// --- QUAKE 3 PLAYER ACTORS ---
+// A player is three MD3s glued by tags: lower.md3 carries tag_torso, upper.md3 carries tag_head and
+// tag_weapon. animation.cfg gives every animation as "first num loop fps" in the fixed order below.
+// Legs and torso animate independently; GDK_MD3_Actor_UpdateAll advances every actor and resolves the
+// whole lower -> upper -> head/weapon chain in one parallel pass, so drawing is just matrix loads.
+
+enum GDK_MD3_AnimID {
+    GDK_MD3_BOTH_DEATH1 = 0, GDK_MD3_BOTH_DEAD1, GDK_MD3_BOTH_DEATH2, GDK_MD3_BOTH_DEAD2,
+    GDK_MD3_BOTH_DEATH3, GDK_MD3_BOTH_DEAD3,
+    GDK_MD3_TORSO_GESTURE, GDK_MD3_TORSO_ATTACK, GDK_MD3_TORSO_ATTACK2, GDK_MD3_TORSO_DROP,
+    GDK_MD3_TORSO_RAISE, GDK_MD3_TORSO_STAND, GDK_MD3_TORSO_STAND2,
+    GDK_MD3_LEGS_WALKCR, GDK_MD3_LEGS_WALK, GDK_MD3_LEGS_RUN, GDK_MD3_LEGS_BACK, GDK_MD3_LEGS_SWIM,
+    GDK_MD3_LEGS_JUMP, GDK_MD3_LEGS_LAND, GDK_MD3_LEGS_JUMPB, GDK_MD3_LEGS_LANDB,
+    GDK_MD3_LEGS_IDLE, GDK_MD3_LEGS_IDLECR, GDK_MD3_LEGS_TURN,
+    GDK_MD3_ANIM_COUNT
+};
+
+enum GDK_MD3_Part { GDK_MD3_LOWER = 0, GDK_MD3_UPPER, GDK_MD3_HEAD, GDK_MD3_WEAPON, GDK_MD3_PART_COUNT };
+
+struct GDK_MD3_AnimDef {
+    int first = 0, num = 1, loop = 0; // loop = trailing frames that repeat (0 = hold the last frame)
+    float fps = 15.0f;
+};
+
+struct GDK_MD3_AnimState {
+    int anim = -1;
+    float time = 0.0f;
+    int frameA = 0, frameB = 0;
+    float lerp = 0.0f;
+};
+
+struct GDK_MD3_Actor {
+    bool InUse = false;
+    int part[GDK_MD3_PART_COUNT] = { -1, -1, -1, -1 }; // Model indices (The weapon is borrowed, not owned)
+    GDK_MD3_AnimDef anims[GDK_MD3_ANIM_COUNT];
+    GDK_MD3_AnimState legs, torso;
+    glm::mat4 transform = glm::mat4(1.0f);
+    glm::mat4 world[GDK_MD3_PART_COUNT];       // Filled by GDK_MD3_Actor_UpdateAll
+
+    void Free() {
+        for (int p = GDK_MD3_LOWER; p <= GDK_MD3_HEAD; ++p) {
+            if (part[p] >= 0) GDK_Model_Free(part[p]);
+        }
+        for (int p = 0; p < GDK_MD3_PART_COUNT; ++p) part[p] = -1;
+        legs = GDK_MD3_AnimState();
+        torso = GDK_MD3_AnimState();
+        transform = glm::mat4(1.0f);
+        InUse = false;
+    }
+};
+
+static std::vector<GDK_MD3_Actor> g_MD3Actors;
+
+// Reads animation.cfg. Legs frames in the file count the torso-only block, which lower.md3 does not
+// contain, so LEGS_* are shifted back by that block like the Quake 3 loader does.
+static bool GDK_Internal_MD3ParseAnimCfg(const std::string& path, GDK_MD3_AnimDef* anims) {
+    std::ifstream f(path);
+    if (!f) return false;
+
+    int count = 0;
+    std::string line;
+    while (count < GDK_MD3_ANIM_COUNT && std::getline(f, line)) {
+        size_t c = line.find("//");
+        if (c != std::string::npos) line.erase(c);
+        std::istringstream ss(line);
+        int first, num, loop;
+        float fps;
+        if (!(ss >> first >> num >> loop >> fps)) continue; // sex / headoffset / footsteps / blank
+        anims[count].first = first;
+        anims[count].num = std::max(1, num);
+        anims[count].loop = std::max(0, std::min(loop, anims[count].num));
+        anims[count].fps = (fps > 0.0f) ? fps : 15.0f;
+        count++;
+    }
+    if (count < GDK_MD3_ANIM_COUNT) return false;
+
+    int skip = anims[GDK_MD3_LEGS_WALKCR].first - anims[GDK_MD3_TORSO_GESTURE].first;
+    for (int i = GDK_MD3_LEGS_WALKCR; i < GDK_MD3_ANIM_COUNT; ++i) anims[i].first -= skip;
+    return true;
+}
+
+// Frame 'n' of an animation, wrapping into the loop block or holding the last frame
+static int GDK_Internal_MD3AnimFrame(const GDK_MD3_AnimDef& a, int n) {
+    if (n >= a.num) {
+        if (a.loop > 0) n = a.num - a.loop + (n - a.num) % a.loop;
+        else n = a.num - 1;
+    }
+    return a.first + n;
+}
+
+static void GDK_Internal_MD3AdvanceAnim(const GDK_MD3_Actor& actor, GDK_MD3_AnimState& s, float dt) {
+    if (s.anim < 0) { s.frameA = s.frameB = 0; s.lerp = 0.0f; return; }
+    const GDK_MD3_AnimDef& a = actor.anims[s.anim];
+    s.time += dt;
+    float t = s.time * a.fps;
+    int n = (int)t;
+    s.frameA = GDK_Internal_MD3AnimFrame(a, n);
+    s.frameB = GDK_Internal_MD3AnimFrame(a, n + 1);
+    s.lerp = (s.frameA == s.frameB) ? 0.0f : t - (float)n;
+}
+
+static void GDK_Internal_MD3SetAnim(GDK_MD3_AnimState& s, int anim) {
+    if (s.anim == anim) return; // Re-requesting the current animation does not restart it
+    s.anim = anim;
+    s.time = 0.0f;
+}
+
+// Walks one actor's tag chain (Reads g_ModelStore only, so actors can run in parallel)
+static void GDK_Internal_MD3ResolveActor(GDK_MD3_Actor& a, float dt, int tagTorso, int tagHead, int tagWeapon) {
+    GDK_Internal_MD3AdvanceAnim(a, a.legs, dt);
+    GDK_Internal_MD3AdvanceAnim(a, a.torso, dt);
+
+    auto Model = [](int mIdx) -> const GDK_Legacy_Model* {
+        if (mIdx < 0 || (size_t)mIdx >= gdk_models.size() || gdk_models[mIdx].TypeID != MD3) return nullptr;
+        int idx = gdk_models[mIdx].InternalIndex;
+        return (idx >= 0 && (size_t)idx < g_ModelStore.size()) ? &g_ModelStore[idx] : nullptr;
+    };
+
+    glm::mat4 tag;
+    a.world[GDK_MD3_LOWER] = a.transform;
+    a.world[GDK_MD3_UPPER] = a.transform;
+    if (const GDK_Legacy_Model* lower = Model(a.part[GDK_MD3_LOWER])) {
+        if (GDK_Internal_MD3TagMatrix(*lower, tagTorso, a.legs.frameA, a.legs.frameB, a.legs.lerp, tag))
+            a.world[GDK_MD3_UPPER] = a.transform * tag;
+    }
+
+    a.world[GDK_MD3_HEAD] = a.world[GDK_MD3_UPPER];
+    a.world[GDK_MD3_WEAPON] = a.world[GDK_MD3_UPPER];
+    if (const GDK_Legacy_Model* upper = Model(a.part[GDK_MD3_UPPER])) {
+        if (GDK_Internal_MD3TagMatrix(*upper, tagHead, a.torso.frameA, a.torso.frameB, a.torso.lerp, tag))
+            a.world[GDK_MD3_HEAD] = a.world[GDK_MD3_UPPER] * tag;
+        if (GDK_Internal_MD3TagMatrix(*upper, tagWeapon, a.torso.frameA, a.torso.frameB, a.torso.lerp, tag))
+            a.world[GDK_MD3_WEAPON] = a.world[GDK_MD3_UPPER] * tag;
+    }
+}
+
+static GDK_MD3_Actor* GDK_Internal_GetActor(int actorIdx) {
+    if (actorIdx < 0 || (size_t)actorIdx >= g_MD3Actors.size() || !g_MD3Actors[actorIdx].InUse) return nullptr;
+    return &g_MD3Actors[actorIdx];
+}
+
+GDK_BEGIN_DECLS
+
+// Loads <dir>/lower.md3, upper.md3, head.md3 and animation.cfg (Skins come from <part>_default.skin).
+// Returns an actor index, or -1.
+GDK_API int GDK_MD3_Actor_Load(const char* dir) {
+    if (!dir) return -1;
+    std::string base = dir;
+    if (!base.empty() && base.back() != '/' && base.back() != '\\') base += "/";
+
+    int slot = -1;
+    for (int i = 0; i < (int)g_MD3Actors.size(); ++i) {
+        if (!g_MD3Actors[i].InUse) { slot = i; break; }
+    }
+    if (slot == -1) {
+        g_MD3Actors.push_back(GDK_MD3_Actor());
+        slot = (int)g_MD3Actors.size() - 1;
+    }
+    GDK_MD3_Actor& a = g_MD3Actors[slot];
+    a = GDK_MD3_Actor();
+
+    const char* files[] = { "lower.md3", "upper.md3", "head.md3" };
+    for (int p = GDK_MD3_LOWER; p <= GDK_MD3_HEAD; ++p) {
+        a.part[p] = GDK_Model_Load((base + files[p]).c_str(), "");
+        if (a.part[p] < 0) {
+            printf("[MD3 ERR] Actor part missing: %s%s\n", base.c_str(), files[p]);
+            a.Free();
+            return -1;
+        }
+    }
+
+    if (!GDK_Internal_MD3ParseAnimCfg(base + "animation.cfg", a.anims)) {
+        printf("[MD3] No usable animation.cfg in %s - actor stays on frame 0\n", base.c_str());
+        for (auto& def : a.anims) def = GDK_MD3_AnimDef();
+    } else {
+        GDK_Internal_MD3SetAnim(a.legs, GDK_MD3_LEGS_IDLE);
+        GDK_Internal_MD3SetAnim(a.torso, GDK_MD3_TORSO_STAND);
+    }
+
+    a.InUse = true;
+    GDK_Internal_MD3ResolveActor(a, 0.0f, GDK_Internal_InternTag("tag_torso"), GDK_Internal_InternTag("tag_head"),
+                                 GDK_Internal_InternTag("tag_weapon"));
+    return slot;
+}
+
+GDK_API void GDK_MD3_Actor_Free(int actorIdx) {
+    if (GDK_MD3_Actor* a = GDK_Internal_GetActor(actorIdx)) a->Free();
+}
+
+// BOTH_* drives legs and torso, TORSO_* / LEGS_* only their half
+GDK_API void GDK_MD3_Actor_SetAnim(int actorIdx, int anim) {
+    GDK_MD3_Actor* a = GDK_Internal_GetActor(actorIdx);
+    if (!a || anim < 0 || anim >= GDK_MD3_ANIM_COUNT) return;
+    if (anim < GDK_MD3_LEGS_WALKCR) GDK_Internal_MD3SetAnim(a->torso, anim);
+    if (anim <= GDK_MD3_BOTH_DEAD3 || anim >= GDK_MD3_LEGS_WALKCR) GDK_Internal_MD3SetAnim(a->legs, anim);
+}
+
+// Any MD3 with the weapon at its origin (-1 = none). Not freed with the actor.
+GDK_API void GDK_MD3_Actor_SetWeapon(int actorIdx, int modelIdx) {
+    if (GDK_MD3_Actor* a = GDK_Internal_GetActor(actorIdx)) a->part[GDK_MD3_WEAPON] = modelIdx;
+}
+
+// Actor root in world space (16 floats, column major). NULL = identity.
+GDK_API void GDK_MD3_Actor_SetMatrix(int actorIdx, const float* m16) {
+    GDK_MD3_Actor* a = GDK_Internal_GetActor(actorIdx);
+    if (!a) return;
+    a->transform = m16 ? glm::make_mat4(m16) : glm::mat4(1.0f);
+}
+
+// Advances every actor's animations by dt and computes all part matrices. Call once per frame before drawing.
+GDK_API void GDK_MD3_Actor_UpdateAll(float dt) {
+    if (g_MD3Actors.empty()) return;
+    // Intern on this thread - the table is not locked
+    static const int tagTorso = GDK_Internal_InternTag("tag_torso");
+    static const int tagHead = GDK_Internal_InternTag("tag_head");
+    static const int tagWeapon = GDK_Internal_InternTag("tag_weapon");
+
+    GDK::Jobs::ParallelFor((int)g_MD3Actors.size(), 16, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            if (g_MD3Actors[i].InUse) GDK_Internal_MD3ResolveActor(g_MD3Actors[i], dt, tagTorso, tagHead, tagWeapon);
+        }
+    });
+}
+
+// World matrix of one part as of the last update (16 floats). Returns 0 for a bad actor/part.
+GDK_API int GDK_MD3_Actor_GetPartMatrix(int actorIdx, int part, float* out16) {
+    GDK_MD3_Actor* a = GDK_Internal_GetActor(actorIdx);
+    if (!a || part < 0 || part >= GDK_MD3_PART_COUNT || !out16) return 0;
+    memcpy(out16, glm::value_ptr(a->world[part]), sizeof(float) * 16);
+    return 1;
+}
+
+// Draws all parts under the current model matrix
+GDK_API void GDK_MD3_Actor_Draw(int actorIdx) {
+    GDK_MD3_Actor* a = GDK_Internal_GetActor(actorIdx);
+    if (!a) return;
+    GDK::Internal::MatrixStack& stack = GDK::Internal::g_ModelStack;
+    if (!stack.current) return;
+
+    for (int p = 0; p < GDK_MD3_PART_COUNT; ++p) {
+        if (a->part[p] < 0) continue;
+        stack.Push();
+        *stack.current = *stack.current * a->world[p];
+        if (GDK::mode == GDK_MODE_LEGACY) glLoadMatrixf(glm::value_ptr(*stack.current));
+        if (p == GDK_MD3_LOWER || p == GDK_MD3_UPPER) {
+            const GDK_MD3_AnimState& s = (p == GDK_MD3_LOWER) ? a->legs : a->torso;
+            GDK_Model_DrawBlend(a->part[p], -1, s.frameA, s.frameB, s.lerp);
+        } else {
+            GDK_Model_Draw(a->part[p], -1, 0);
+        }
+        stack.Pop();
+    }
+    if (GDK::mode == GDK_MODE_LEGACY) glLoadMatrixf(glm::value_ptr(*stack.current));
+}
+
+GDK_END_DECLS
+
+#endif // GDK_MD3_ACTOR_H
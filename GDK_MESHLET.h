@@ -0,0 +1,353 @@
+#ifndef GDK_MESHLET_H
+#define GDK_MESHLET_H
+
+// --- MESHLETS (Cluster culling for big static meshes) ---
+// Triangle lists are regrouped into clusters of at most GDK_MESHLET_VERTS vertices / GDK_MESHLET_TRIS
+// triangles, each with a bounding sphere and a normal cone. Per draw the clusters are tested against the
+// frustum and (When back faces are culled) the cone, and the survivors go out as one multi-draw - through
+// an indirect buffer where GL 4.3 is there. Cost tracks visible triangles, not the total.
+//
+// Indices keep pointing at the owner's vertex array, so STL/BSP keep their own VBO or client arrays.
+
+#define GDK_MESHLET_VERTS    64
+#define GDK_MESHLET_TRIS     124
+#define GDK_MESHLET_MIN_TRIS 4096   // Smaller meshes just draw whole
+#define GDK_MESHLET_CULL_GRAIN 1024 // Clusters per cull job
+
+struct GDK_Meshlet {
+    uint32_t firstIndex, numTris;  // Range in GDK_MeshletSet::indices
+    glm::vec3 center;
+    float radius;
+    glm::vec3 coneAxis;            // Average facing of the cluster
+    float coneCos, coneSin;        // Spread of the normals around it (coneCos <= 0 = never backface culled)
+};
+
+struct GDK_MeshletGroup { uint32_t firstMeshlet, numMeshlets; }; // One per material
+
+struct GDK_DrawElementsIndirectCommand {
+    GLuint count, instanceCount, firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+
+struct GDK_MeshletSet {
+    std::vector<GDK_Meshlet> meshlets;
+    std::vector<GDK_MeshletGroup> groups;
+    std::vector<uint32_t> indices;     // Cluster-ordered triangle list
+    uint32_t ebo = 0, indirect = 0;
+
+    // Output of the last cull: commands for group g are cmds[groupCmd[g] .. groupCmd[g + 1])
+    std::vector<GDK_DrawElementsIndirectCommand> cmds;
+    std::vector<uint32_t> groupCmd;
+    std::vector<uint8_t> visible;
+
+    bool Empty() const { return meshlets.empty(); }
+    void Free() {
+        if (ebo) glDeleteBuffers(1, &ebo);
+        if (indirect) glDeleteBuffers(1, &indirect);
+        ebo = indirect = 0;
+        meshlets.clear(); groups.clear(); indices.clear();
+        cmds.clear(); groupCmd.clear(); visible.clear();
+    }
+};
+
+struct GDK_ClusterStats {
+    uint32_t tested;   // Clusters tested (Last completed frame)
+    uint32_t visible;  // ...that were drawn
+    uint32_t tris;     // Triangles they held
+};
+
+static bool g_ClusterCulling = true;               // GDK_Model_SetClusterCulling
+static GDK_ClusterStats g_ClusterStatsFrame = {};  // Counting
+static GDK_ClusterStats g_ClusterStatsLast = {};   // Reported
+
+static void GDK_Internal_ClusterStatsFrame() {
+    g_ClusterStatsLast = g_ClusterStatsFrame;
+    g_ClusterStatsFrame = GDK_ClusterStats();
+}
+
+// Open-addressed weld over 'n' items with W-word keys: ids[i] = unique index of item i, firsts[u] =
+// first item that produced unique u. No key storage - the table holds item indices and re-fetches.
+template <int W, class KeyFn>
+static void GDK_Internal_HashWeld(uint32_t n, const KeyFn& key, std::vector<uint32_t>& ids, std::vector<uint32_t>& firsts) {
+    size_t cap = 16;
+    while (cap < (size_t)n * 2) cap <<= 1;
+    std::vector<uint32_t> table(cap, 0xFFFFFFFFu);
+    ids.resize(n);
+    firsts.clear();
+
+    uint32_t k[W], other[W];
+    for (uint32_t i = 0; i < n; ++i) {
+        key(i, k);
+        uint64_t h = 1469598103934665603ull;
+        for (int w = 0; w < W; ++w) h = (h ^ k[w]) * 1099511628211ull;
+        size_t slot = (size_t)(h ^ (h >> 29)) & (cap - 1);
+        for (;;) {
+            uint32_t e = table[slot];
+            if (e == 0xFFFFFFFFu) {
+                table[slot] = i;
+                ids[i] = (uint32_t)firsts.size();
+                firsts.push_back(i);
+                break;
+            }
+            key(e, other);
+            if (memcmp(k, other, sizeof(k)) == 0) { ids[i] = ids[e]; break; }
+            slot = (slot + 1) & (cap - 1);
+        }
+    }
+}
+
+static inline uint32_t GDK_Internal_WeldFloatKey(float f) {
+    if (f == 0.0f) f = 0.0f; // -0 welds with +0
+    uint32_t u;
+    memcpy(&u, &f, 4);
+    return u;
+}
+
+// Appends one group built from a triangle list. Greedy growth: the next triangle is the neighbour that
+// adds the fewest new vertices, then the one closest to the cluster and facing its way (Tight spheres
+// and cones are what make the culling pay). The list only references verts [baseVertex, baseVertex + numVerts),
+// so per-vertex scratch is sized to that range, not to the whole array.
+static void GDK_Internal_BuildMeshlets(const GDK_Legacy_Vert* verts, size_t numVerts, const uint32_t* idx, size_t numIdx,
+                                       GDK_MeshletSet& set, uint32_t baseVertex = 0) {
+    GDK_MeshletGroup group = { (uint32_t)set.meshlets.size(), 0 };
+    uint32_t numTris = (uint32_t)(numIdx / 3);
+
+    std::vector<uint32_t> adjStart(numVerts + 1, 0), adj((size_t)numTris * 3);
+    for (size_t i = 0; i < (size_t)numTris * 3; ++i) adjStart[idx[i] - baseVertex + 1]++;
+    for (size_t v = 0; v < numVerts; ++v) adjStart[v + 1] += adjStart[v];
+    std::vector<uint32_t> fill(adjStart.begin(), adjStart.end() - 1);
+    for (size_t i = 0; i < (size_t)numTris * 3; ++i) adj[fill[idx[i] - baseVertex]++] = (uint32_t)(i / 3);
+
+    auto P = [&](uint32_t v) { return glm::vec3(verts[v].x, verts[v].y, verts[v].z); };
+    std::vector<glm::vec3> centroid(numTris), normal(numTris);
+    for (uint32_t t = 0; t < numTris; ++t) {
+        glm::vec3 a = P(idx[t * 3]), b = P(idx[t * 3 + 1]), c = P(idx[t * 3 + 2]);
+        centroid[t] = (a + b + c) / 3.0f;
+        glm::vec3 n = glm::cross(b - a, c - a);
+        float len = glm::length(n);
+        normal[t] = len > 0.0f ? n / len : glm::vec3(0.0f);
+    }
+
+    std::vector<uint8_t> used(numTris, 0);
+    std::vector<uint32_t> vertStamp(numVerts, 0), candStamp(numTris, 0), cand, clusterTris;
+    uint32_t stamp = 0, scan = 0;
+
+    for (;;) {
+        // Seed: a leftover neighbour of the last cluster keeps the walk coherent, else the next in order
+        uint32_t seed = 0xFFFFFFFFu;
+        for (uint32_t t : cand) if (!used[t]) { seed = t; break; }
+        if (seed == 0xFFFFFFFFu) {
+            while (scan < numTris && used[scan]) ++scan;
+            if (scan == numTris) break;
+            seed = scan;
+        }
+
+        ++stamp;
+        cand.clear();
+        clusterTris.clear();
+        GDK_Meshlet ml = {};
+        ml.firstIndex = (uint32_t)set.indices.size();
+        uint32_t clusterVerts = 0;
+        glm::vec3 sumC(0.0f), sumN(0.0f);
+        float extent = 0.0f; // Furthest vertex from the seed's centroid - scales the distance term
+
+        auto Add = [&](uint32_t t) {
+            used[t] = 1;
+            clusterTris.push_back(t);
+            for (int k = 0; k < 3; ++k) {
+                uint32_t v = idx[t * 3 + k], lv = v - baseVertex;
+                set.indices.push_back(v);
+                if (vertStamp[lv] != stamp) { vertStamp[lv] = stamp; clusterVerts++; }
+                extent = std::max(extent, glm::length(P(v) - centroid[seed]));
+                for (uint32_t a = adjStart[lv]; a < adjStart[lv + 1]; ++a) {
+                    uint32_t n = adj[a];
+                    if (!used[n] && candStamp[n] != stamp) { candStamp[n] = stamp; cand.push_back(n); }
+                }
+            }
+            ml.numTris++;
+            sumC += centroid[t];
+            sumN += normal[t];
+        };
+        Add(seed);
+
+        while (ml.numTris < GDK_MESHLET_TRIS) {
+            glm::vec3 c = sumC / (float)ml.numTris;
+            float nl = glm::length(sumN);
+            glm::vec3 axis = nl > 0.0f ? sumN / nl : glm::vec3(0.0f);
+            float scale = 1.0f / (extent + 1e-6f);
+
+            uint32_t best = 0xFFFFFFFFu;
+            float bestScore = 1e30f;
+            size_t keep = 0;
+            for (size_t i = 0; i < cand.size(); ++i) {
+                uint32_t t = cand[i];
+                if (used[t]) continue;
+                cand[keep++] = t;
+                int fresh = 0;
+                for (int k = 0; k < 3; ++k) fresh += (vertStamp[idx[t * 3 + k] - baseVertex] != stamp);
+                if (clusterVerts + fresh > GDK_MESHLET_VERTS) continue;
+                float score = (float)fresh + 0.5f * glm::length(centroid[t] - c) * scale + 0.5f * (1.0f - glm::dot(normal[t], axis));
+                if (score < bestScore) { bestScore = score; best = t; }
+            }
+            cand.resize(keep);
+            if (best == 0xFFFFFFFFu) break;
+            Add(best);
+        }
+
+        // Sphere around the box centre, cone from the averaged facing
+        const uint32_t* mi = &set.indices[ml.firstIndex];
+        glm::vec3 mn = P(mi[0]), mx = mn;
+        for (uint32_t i = 1; i < ml.numTris * 3; ++i) { mn = glm::min(mn, P(mi[i])); mx = glm::max(mx, P(mi[i])); }
+        ml.center = (mn + mx) * 0.5f;
+        float r2 = 0.0f;
+        for (uint32_t i = 0; i < ml.numTris * 3; ++i) { glm::vec3 d = P(mi[i]) - ml.center; r2 = std::max(r2, glm::dot(d, d)); }
+        ml.radius = std::sqrt(r2);
+
+        float nl = glm::length(sumN);
+        ml.coneAxis = nl > 0.0f ? sumN / nl : glm::vec3(0.0f, 0.0f, 1.0f);
+        ml.coneCos = nl > 0.0f ? 1.0f : -1.0f;
+        for (uint32_t t : clusterTris) {
+            if (glm::dot(normal[t], normal[t]) == 0.0f) continue; // Degenerate - never drawn
+            ml.coneCos = std::min(ml.coneCos, glm::dot(normal[t], ml.coneAxis));
+        }
+        if (ml.coneCos < 0.1f) ml.coneCos = -1.0f; // Wider than ~84 degrees - some face will always show
+        ml.coneSin = ml.coneCos > 0.0f ? std::sqrt(1.0f - ml.coneCos * ml.coneCos) : 1.0f;
+        set.meshlets.push_back(ml);
+        group.numMeshlets++;
+    }
+    set.groups.push_back(group);
+}
+
+// Tests every cluster against the current modelview/projection and packs the survivors into set.cmds,
+// merging neighbours that are contiguous in the index list. False if nothing is visible.
+static bool GDK_Internal_MeshletCull(GDK_MeshletSet& set) {
+    static bool hooked = false;
+    if (!hooked) { GDK::Internal::AddFrameHook(GDK_Internal_ClusterStatsFrame); hooked = true; }
+
+    size_t n = set.meshlets.size();
+    set.visible.assign(n, 1);
+    if (g_ClusterCulling && GDK::state) {
+        const glm::mat4& mv = GDK::state->view;
+        glm::mat4 clip = GDK::state->projection * mv;
+        glm::vec4 planes[6];
+        for (int p = 0; p < 6; ++p) {
+            glm::vec4 row3(clip[0][3], clip[1][3], clip[2][3], clip[3][3]);
+            int a = p >> 1;
+            glm::vec4 row(clip[0][a], clip[1][a], clip[2][a], clip[3][a]);
+            glm::vec4 pl = (p & 1) ? row3 - row : row3 + row;
+            planes[p] = pl * (1.0f / glm::length(glm::vec3(pl.x, pl.y, pl.z)));
+        }
+        glm::mat4 inv = glm::inverse(mv);
+        glm::vec3 eye(inv[3].x, inv[3].y, inv[3].z); // Camera in model space
+
+        // The cone only proves a cluster invisible if GL drops its back faces
+        GLint frontFace = GL_CCW, cullMode = GL_BACK;
+        bool cone = glIsEnabled(GL_CULL_FACE) == GL_TRUE;
+        if (cone) {
+            glGetIntegerv(GL_FRONT_FACE, &frontFace);
+            glGetIntegerv(GL_CULL_FACE_MODE, &cullMode);
+            cone = (cullMode == GL_BACK);
+        }
+        float facing = (frontFace == GL_CCW) ? 1.0f : -1.0f;
+
+        GDK::Jobs::ParallelFor((int)n, GDK_MESHLET_CULL_GRAIN, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                const GDK_Meshlet& ml = set.meshlets[i];
+                bool vis = true;
+                for (int p = 0; p < 6 && vis; ++p)
+                    vis = glm::dot(glm::vec3(planes[p].x, planes[p].y, planes[p].z), ml.center) + planes[p].w >= -ml.radius;
+
+                // Every normal is within the cone; if even the one turned most toward the eye faces away
+                // from every point of the sphere, the whole cluster is back-facing
+                if (vis && cone && ml.coneCos > 0.0f) {
+                    glm::vec3 d = ml.center - eye;
+                    float len = glm::length(d);
+                    if (len > ml.radius) {
+                        float cosPhi = facing * glm::dot(ml.coneAxis, d) / len;
+                        float sinPhi = std::sqrt(std::max(0.0f, 1.0f - cosPhi * cosPhi));
+                        if (len * (cosPhi * ml.coneCos - sinPhi * ml.coneSin) >= ml.radius) vis = false;
+                    }
+                }
+                set.visible[i] = vis;
+            }
+        });
+    }
+
+    set.cmds.clear();
+    set.groupCmd.assign(set.groups.size() + 1, 0);
+    uint32_t tris = 0;
+    for (size_t g = 0; g < set.groups.size(); ++g) {
+        set.groupCmd[g] = (uint32_t)set.cmds.size();
+        const GDK_MeshletGroup& grp = set.groups[g];
+        for (uint32_t i = grp.firstMeshlet; i < grp.firstMeshlet + grp.numMeshlets; ++i) {
+            if (!set.visible[i]) continue;
+            const GDK_Meshlet& ml = set.meshlets[i];
+            tris += ml.numTris;
+            GDK_DrawElementsIndirectCommand* last = set.cmds.empty() || set.groupCmd[g] == set.cmds.size() ? nullptr : &set.cmds.back();
+            if (last && last->firstIndex + last->count == ml.firstIndex) { last->count += ml.numTris * 3; continue; }
+            set.cmds.push_back({ ml.numTris * 3, 1, ml.firstIndex, 0, 0 });
+        }
+    }
+    set.groupCmd[set.groups.size()] = (uint32_t)set.cmds.size();
+
+    g_ClusterStatsFrame.tested += (uint32_t)n;
+    for (uint8_t v : set.visible) g_ClusterStatsFrame.visible += v;
+    g_ClusterStatsFrame.tris += tris;
+    return !set.cmds.empty();
+}
+
+// Modes 1 & 2: with the owner's VAO bound, attaches the cluster index buffer and uploads this cull's
+// commands. Legacy mode needs nothing - the draws read set.indices directly.
+static void GDK_Internal_MeshletBind(GDK_MeshletSet& set) {
+    if (GDK::mode == GDK_MODE_LEGACY) return;
+    if (!set.ebo) {
+        glGenBuffers(1, &set.ebo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, set.ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, set.indices.size() * 4, set.indices.data(), GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, set.ebo); // VAO state - rebound every draw
+    if (GLEW_ARB_multi_draw_indirect) {
+        if (!set.indirect) glGenBuffers(1, &set.indirect);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, set.indirect);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, set.cmds.size() * sizeof(GDK_DrawElementsIndirectCommand), set.cmds.data(), GL_STREAM_DRAW);
+    }
+}
+
+// Draws the visible clusters of one group (Call between MeshletBind and MeshletUnbind)
+static void GDK_Internal_MeshletDrawGroup(GDK_MeshletSet& set, size_t g) {
+    uint32_t first = set.groupCmd[g], count = set.groupCmd[g + 1] - first;
+    if (!count) return;
+    bool modern = GDK::mode != GDK_MODE_LEGACY;
+    if (modern && GLEW_ARB_multi_draw_indirect) {
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)((size_t)first * sizeof(GDK_DrawElementsIndirectCommand)), (GLsizei)count, 0);
+        return;
+    }
+    static std::vector<GLsizei> counts;
+    static std::vector<const void*> offs;
+    counts.resize(count); offs.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const GDK_DrawElementsIndirectCommand& c = set.cmds[first + i];
+        counts[i] = (GLsizei)c.count;
+        offs[i] = modern ? (const void*)((size_t)c.firstIndex * 4) : (const void*)(set.indices.data() + c.firstIndex);
+    }
+    glMultiDrawElements(GL_TRIANGLES, counts.data(), GL_UNSIGNED_INT, offs.data(), (GLsizei)count);
+}
+
+static void GDK_Internal_MeshletUnbind() {
+    if (GDK::mode != GDK_MODE_LEGACY && GLEW_ARB_multi_draw_indirect) glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+GDK_BEGIN_DECLS
+
+// Per-cluster frustum/backface culling for meshes drawn as meshlets (Default on)
+GDK_API void GDK_Model_SetClusterCulling(int enable) { g_ClusterCulling = (enable != 0); }
+
+// Cluster counts for the last completed frame
+GDK_API void GDK_Model_GetClusterStats(GDK_ClusterStats* out) {
+    if (out) *out = g_ClusterStatsLast;
+}
+
+GDK_END_DECLS
+
+#endif // GDK_MESHLET_H
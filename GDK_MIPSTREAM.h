@@ -0,0 +1,424 @@
+#ifndef GDK_MIPSTREAM_H
+#define GDK_MIPSTREAM_H
+
+// --- MIP STREAMING ---
+// Streamed textures start with only the small end of the mip chain in VRAM (<= GDK_MIPSTREAM_START_SIZE).
+// Draws report how big the texture lands on screen; a frame hook works out the finest level each texture
+// needs, re-decodes the missing levels on the job pool and uploads them, and drops levels nobody has needed
+// for a while. Everything streamed shares one VRAM budget.
+//
+// Residency is the GL_TEXTURE_BASE_LEVEL..MAX_LEVEL window: levels above the window are never defined, so
+// they cost nothing. No sparse textures - ARB_sparse_texture page sizes make small skins all-or-nothing anyway.
+// The GL name never changes, because models and PRM pages hold it raw. Bindless handles would freeze it, so in
+// AZDO a slot that is asked for a handle gets a GPU copy of its window to take handles from instead; that copy is
+// rebuilt on each residency change and the bindless table picks up the new name on the next touch.
+
+#define GDK_MIPSTREAM_START_SIZE  64 // Initial residency: levels no bigger than this
+#define GDK_MIPSTREAM_HOLD_FRAMES 90 // A finer level stays this long after the last draw that needed it
+#define GDK_MIPSTREAM_MAX_JOBS    4  // Decodes in flight
+#define GDK_MIPSTREAM_KEEP_FRAMES 2  // Over budget: never shed a level a frame still in flight may sample
+
+struct GDK_Internal_MipJob {
+    int from = 0, to = 0;                     // Levels [from, to)
+    std::vector<std::vector<uint8_t>> levels; // One buffer per level, 'from' first
+    bool ok = false;
+    std::atomic<bool> done{ false };
+};
+
+struct GDK_Internal_MipStream {
+    std::string path;
+    int flags = 0;
+    GLenum format = 0;        // 0 = RGBA8, otherwise the BC format of the .dds cache
+    int w = 0, h = 0, levels = 0;
+    int start = 0;            // Coarsest level that is ever dropped to
+    int base = 0;             // Finest resident level
+    int want = 0;             // Finest level asked for this frame
+    int hold = 0;             // Level being kept...
+    uint64_t holdFrame = 0;   // ...since this frame
+    uint64_t lastUse = 0;
+    uint32_t gen = 0;         // Texture slot generation (Slot freed = stale)
+    bool handleCopy = false;  // AZDO handle copy exists, so the window sits in VRAM twice
+    std::shared_ptr<GDK_Internal_MipJob> job;
+};
+
+struct GDK_MipStreamStats {
+    uint32_t textures;       // Streamed textures alive
+    uint32_t jobs;           // Decodes in flight
+    uint64_t residentBytes;  // VRAM held by streamed textures (Including AZDO handle copies)
+    uint64_t budgetBytes;
+    uint32_t levelsIn;       // Totals since boot
+    uint32_t levelsOut;
+    uint32_t starved;        // Frames a wanted level did not fit in the budget
+};
+
+static std::unordered_map<int, GDK_Internal_MipStream> g_MipStreams; // Texture slot -> stream
+static size_t g_MipStreamBudget = (size_t)256 * 1024 * 1024;
+static GDK_MipStreamStats g_MipStreamStats = {};
+
+static void GDK_Internal_MipDims(const GDK_Internal_MipStream& s, int l, int& lw, int& lh) {
+    lw = std::max(1, s.w >> l); lh = std::max(1, s.h >> l);
+}
+
+static size_t GDK_Internal_MipLevelBytes(const GDK_Internal_MipStream& s, int l) {
+    int lw, lh;
+    GDK_Internal_MipDims(s, l, lw, lh);
+    if (!s.format) return (size_t)lw * lh * 4;
+    size_t block = (s.format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT) ? 8 : 16;
+    return (size_t)((lw + 3) / 4) * ((lh + 3) / 4) * block;
+}
+
+// VRAM for levels [base, levels)
+static size_t GDK_Internal_MipResidentBytes(const GDK_Internal_MipStream& s, int base) {
+    size_t total = 0;
+    for (int l = base; l < s.levels; ++l) total += GDK_Internal_MipLevelBytes(s, l);
+    return total;
+}
+
+// What the window [base, levels) costs against the budget, handle copy included
+static size_t GDK_Internal_MipFootprint(const GDK_Internal_MipStream& s, int base) {
+    return GDK_Internal_MipResidentBytes(s, base) * (s.handleCopy ? 2 : 1);
+}
+
+// Worker-safe. Produces levels [from, to) of s.path. If s.levels is 0 the image is probed first
+// (Size, format, level count) and from < 0 means "the start level".
+static bool GDK_Internal_MipStreamDecode(GDK_Internal_MipStream& s, bool compressed, int from, int to,
+                                         std::vector<std::vector<uint8_t>>& out) {
+    out.clear();
+    if (compressed) {
+        GDK_Internal_BCImage bc;
+        if (!GDK_Internal_LoadBCImage(s.path.c_str(), bc)) return false;
+        if (!s.levels) {
+            s.format = bc.format; s.w = bc.w; s.h = bc.h; s.levels = bc.Levels();
+        } else if (bc.format != s.format || bc.w != s.w || bc.h != s.h || bc.Levels() != s.levels) {
+            return false; // Source changed under us - keep what is resident
+        }
+        if (from < 0) from = s.start;
+        if (to < 0) to = s.levels;
+        for (int l = from; l < to; ++l) {
+            const uint8_t* p = bc.data.data() + bc.offsets[l];
+            out.emplace_back(p, p + bc.LevelSize(l));
+        }
+        return true;
+    }
+
+    GDK_Internal_Image img;
+    if (!GDK_Internal_DecodeImage(s.path.c_str(), img)) return false;
+    if (!s.levels) {
+        s.format = 0; s.w = img.w; s.h = img.h;
+        s.levels = 1;
+        for (int lw = img.w, lh = img.h; lw > 1 || lh > 1; lw = std::max(1, lw / 2), lh = std::max(1, lh / 2)) s.levels++;
+    } else if (s.format || img.w != s.w || img.h != s.h) {
+        img.Free();
+        return false;
+    }
+    if (from < 0) from = s.start;
+    if (to < 0) to = s.levels;
+
+    GDK_Internal_MipChain chain;
+    GDK_Internal_BuildMipChain(img.data, img.w, img.h, GDK_MIP_DEFAULT, chain, to);
+    img.Free();
+    for (int l = from; l < to; ++l) out.emplace_back(chain.Level(l), chain.Level(l) + chain.LevelSize(l));
+    return true;
+}
+
+static int GDK_Internal_MipStartLevel(const GDK_Internal_MipStream& s) {
+    int l = 0;
+    while (l + 1 < s.levels && std::max(s.w >> l, s.h >> l) > GDK_MIPSTREAM_START_SIZE) l++;
+    return l;
+}
+
+// Defines level 'l' of the bound texture (pixels may be null = allocate only)
+static void GDK_Internal_MipUploadLevel(const GDK_Internal_MipStream& s, int l, const void* pixels) {
+    int lw, lh;
+    GDK_Internal_MipDims(s, l, lw, lh);
+    if (s.format) glCompressedTexImage2D(GL_TEXTURE_2D, l, s.format, lw, lh, 0, (GLsizei)GDK_Internal_MipLevelBytes(s, l), pixels);
+    else glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA8, lw, lh, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+}
+
+static void GDK_Internal_MipApplyWindow(const GDK_Internal_MipStream& s) {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, s.base);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, s.levels - 1);
+}
+
+// (Re)builds the texture bindless handles of 'slot' come from: the resident window, copied on the GPU
+static void GDK_Internal_MipBuildHandleTexture(int slot, GDK_Internal_MipStream& s) {
+    GDK_Internal_TextureEntry& e = g_TextureInfo[slot];
+    GLuint tex;
+    glGenTextures(1, &tex);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    for (int l = s.base; l < s.levels; ++l) GDK_Internal_MipUploadLevel(s, l, nullptr);
+    GDK_Internal_MipApplyWindow(s); // Complete before the copies
+    GDK_Internal_ApplyTextureParams(s.flags);
+    for (int l = s.base; l < s.levels; ++l) {
+        int lw, lh;
+        GDK_Internal_MipDims(s, l, lw, lh);
+        glCopyImageSubData(g_Textures[slot], GL_TEXTURE_2D, l, 0, 0, 0, tex, GL_TEXTURE_2D, l, 0, 0, 0, lw, lh, 1);
+    }
+    size_t bytes = GDK_Internal_MipResidentBytes(s, s.base);
+    if (e.handleTex) {
+        GDK_Internal_BindlessForget(slot); // Before the old copy dies
+        glDeleteTextures(1, (GLuint*)&e.handleTex);
+        g_TextureStats.bytes -= e.handleBytes;
+    } else {
+        // First copy - from now on the window counts twice (Rebuilds are covered by MipSetBase)
+        s.handleCopy = true;
+        g_MipStreamStats.residentBytes += bytes;
+    }
+    g_TextureStats.bytes += bytes;
+    e.handleTex = tex;
+    e.handleBytes = bytes;
+}
+
+// Moves the resident window of 'slot' to start at newBase. 'data' holds levels [newBase, s.base) when growing.
+static void GDK_Internal_MipSetBase(int slot, GDK_Internal_MipStream& s, int newBase, const std::vector<std::vector<uint8_t>>* data) {
+    if (newBase == s.base) return;
+    size_t oldBytes = GDK_Internal_MipResidentBytes(s, s.base);
+    size_t newBytes = GDK_Internal_MipResidentBytes(s, newBase);
+    size_t copies = s.handleCopy ? 2 : 1;
+    int oldBase = s.base;
+    uint32_t tex = g_Textures[slot];
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // Same GL name, so holders of the raw name (Models, PRM pages) keep working
+    glBindTexture(GL_TEXTURE_2D, tex);
+    if (newBase < oldBase) {
+        for (int l = newBase; l < oldBase; ++l) GDK_Internal_MipUploadLevel(s, l, (*data)[l - newBase].data());
+        s.base = newBase;
+        GDK_Internal_MipApplyWindow(s);
+    } else {
+        s.base = newBase;
+        GDK_Internal_MipApplyWindow(s);
+        // Shrink the dropped levels to nothing so the driver can release them
+        for (int l = oldBase; l < newBase; ++l) glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+    if (g_TextureInfo[slot].handleTex) GDK_Internal_MipBuildHandleTexture(slot, s);
+
+    if (newBase < oldBase) g_MipStreamStats.levelsIn += oldBase - newBase;
+    else g_MipStreamStats.levelsOut += newBase - oldBase;
+    g_MipStreamStats.residentBytes = g_MipStreamStats.residentBytes - oldBytes * copies + newBytes * copies;
+    g_TextureStats.bytes = g_TextureStats.bytes - oldBytes + newBytes;
+    g_TextureInfo[slot].bytes = newBytes;
+}
+
+// Level a sphere of 'radius' (Object space, current view matrix) needs: one texel per pixel across it
+static int GDK_Internal_MipLevelForSphere(const GDK_Internal_MipStream& s, float radius) {
+    if (!GDK::state || radius <= 0.0f) return 0;
+    const glm::mat4& view = GDK::state->view;
+    float dist = glm::length(glm::vec3(view[3].x, view[3].y, view[3].z));
+    float scale = glm::length(glm::vec3(view[0].x, view[0].y, view[0].z));
+    if (dist <= radius * scale) return 0; // Camera inside the bounds
+
+    float pixels = radius * scale * GDK::state->projection[1][1] * GDK::state->resolution.y / dist;
+    float texels = (float)std::max(s.w, s.h);
+    if (pixels >= texels) return 0;
+    int l = (int)std::floor(std::log2(texels / std::max(pixels, 1.0f)));
+    return std::min(l, s.start);
+}
+
+static GDK_Internal_MipStream* GDK_Internal_FindMipStream(int slot) {
+    if (g_MipStreams.empty()) return nullptr;
+    auto it = g_MipStreams.find(slot);
+    return (it != g_MipStreams.end()) ? &it->second : nullptr;
+}
+
+// Draw-side feed: 'level' is the finest mip the current draw can show
+static void GDK_Internal_MipStreamRequest(int slot, int level) {
+    GDK_Internal_MipStream* s = GDK_Internal_FindMipStream(slot);
+    if (!s) return;
+    s->want = std::min(s->want, std::max(level, 0));
+    s->lastUse = GDK::state ? (uint64_t)GDK::state->frameCount : 0;
+}
+
+static void GDK_Internal_MipStreamTouch(int slot, float radius) {
+    GDK_Internal_MipStream* s = GDK_Internal_FindMipStream(slot);
+    if (s) GDK_Internal_MipStreamRequest(slot, GDK_Internal_MipLevelForSphere(*s, radius));
+}
+
+// Same, for loaders that only kept the GL name
+static void GDK_Internal_MipStreamTouchName(uint32_t glName, float radius) {
+    if (g_MipStreams.empty() || glName == 0) return;
+    auto it = g_TextureByName.find(glName);
+    if (it != g_TextureByName.end()) GDK_Internal_MipStreamTouch(it->second, radius);
+}
+
+// Slot freed (Its bytes already left g_TextureStats) - an in-flight decode just finishes unseen
+static void GDK_Internal_DropMipStream(const GDK_Internal_MipStream& s) {
+    g_MipStreamStats.residentBytes -= GDK_Internal_MipFootprint(s, s.base);
+    if (s.job) g_MipStreamStats.jobs--;
+}
+
+static void GDK_Internal_MipStreamLaunch(int slot, GDK_Internal_MipStream& s, int from) {
+    auto jp = std::make_shared<GDK_Internal_MipJob>();
+    jp->from = from; jp->to = s.base;
+    s.job = jp;
+    g_MipStreamStats.jobs++;
+
+    GDK_Internal_MipStream info = s; // Workers never touch the live record
+    info.job.reset();
+    GDK::Jobs::Push([jp, info]() mutable {
+        jp->ok = GDK_Internal_MipStreamDecode(info, info.format != 0, jp->from, jp->to, jp->levels);
+        jp->done.store(true);
+    });
+}
+
+// Frame hook: retire stale streams, apply finished decodes, then grow/shrink windows under the budget
+static void GDK_Internal_PumpMipStreams() {
+    if (g_MipStreams.empty()) return;
+    uint64_t frame = GDK::state ? (uint64_t)GDK::state->frameCount : 0;
+    size_t uploaded = 0;
+    size_t reserved = 0; // Bytes promised to decodes in flight
+    std::vector<int> grow;
+
+    for (auto it = g_MipStreams.begin(); it != g_MipStreams.end(); ) {
+        int slot = it->first;
+        GDK_Internal_MipStream& s = it->second;
+        if (g_TextureInfo[slot].gen != s.gen || g_TextureInfo[slot].refs <= 0) {
+            GDK_Internal_DropMipStream(s);
+            it = g_MipStreams.erase(it);
+            continue;
+        }
+        ++it;
+
+        GDK_Internal_TextureEntry& e = g_TextureInfo[slot];
+        if (e.handleWanted && !e.handleTex && GDK_Internal_BindlessAvailable()) GDK_Internal_MipBuildHandleTexture(slot, s);
+
+        if (s.job && s.job->done.load() && uploaded < g_TexUploadBudget) {
+            std::shared_ptr<GDK_Internal_MipJob> jp = s.job;
+            s.job.reset();
+            g_MipStreamStats.jobs--;
+            if (!jp->ok) printf("[GDK ERR] Mip stream re-decode failed: %s\n", s.path.c_str());
+            else if (jp->to == s.base) { // Window did not move while decoding
+                GDK_Internal_MipSetBase(slot, s, jp->from, &jp->levels);
+                for (auto& l : jp->levels) uploaded += l.size();
+            }
+        }
+        if (s.job) reserved += GDK_Internal_MipFootprint(s, s.job->from) - GDK_Internal_MipFootprint(s, s.base);
+
+        // Keep the finest recent request for HOLD frames so a model turning away does not thrash
+        if (s.want <= s.hold || frame - s.holdFrame > GDK_MIPSTREAM_HOLD_FRAMES) {
+            s.hold = s.want;
+            s.holdFrame = frame;
+        }
+        s.want = s.start; // Undrawn textures drift back to the start level
+
+        if (s.hold > s.base && !s.job) GDK_Internal_MipSetBase(slot, s, s.hold, nullptr);
+        else if (s.hold < s.base) grow.push_back(slot);
+    }
+
+    // Over budget (It was lowered, or AZDO copies raced) - shed levels from the least recently drawn
+    while (g_MipStreamStats.residentBytes > g_MipStreamBudget) {
+        int victim = -1;
+        for (auto& kv : g_MipStreams) {
+            const GDK_Internal_MipStream& s = kv.second;
+            if (s.job || s.base >= s.start || s.lastUse + GDK_MIPSTREAM_KEEP_FRAMES > frame) continue;
+            if (victim < 0 || s.lastUse < g_MipStreams[victim].lastUse) victim = kv.first;
+        }
+        if (victim < 0) break;
+        GDK_Internal_MipStream& v = g_MipStreams[victim];
+        GDK_Internal_MipSetBase(victim, v, v.base + 1, nullptr);
+    }
+
+    // Biggest shortfall first; one level at a time when the whole jump does not fit
+    std::sort(grow.begin(), grow.end(), [](int a, int b) {
+        const GDK_Internal_MipStream& sa = g_MipStreams[a]; const GDK_Internal_MipStream& sb = g_MipStreams[b];
+        return (sa.base - sa.hold) > (sb.base - sb.hold);
+    });
+    for (int slot : grow) {
+        if (g_MipStreamStats.jobs >= GDK_MIPSTREAM_MAX_JOBS) break;
+        GDK_Internal_MipStream& s = g_MipStreams[slot];
+        if (s.job) continue;
+        size_t have = g_MipStreamStats.residentBytes + reserved;
+        size_t cur = GDK_Internal_MipFootprint(s, s.base);
+        int from = s.hold;
+        while (from < s.base && have + GDK_Internal_MipFootprint(s, from) - cur > g_MipStreamBudget) from++;
+        if (from == s.base) { g_MipStreamStats.starved++; continue; }
+        reserved += GDK_Internal_MipFootprint(s, from) - cur;
+        GDK_Internal_MipStreamLaunch(slot, s, from);
+    }
+}
+
+// Synchronous first load: probe + decode, upload only the start window
+static int GDK_Internal_AcquireStreamedTexture(const char* path, int flags) {
+    if (!path || !*path) return -1;
+    std::string key = "stream:" + GDK_Internal_NormalizeTexturePath(path, flags);
+
+    auto it = g_TextureCache.find(key);
+    if (it != g_TextureCache.end()) {
+        g_TextureInfo[it->second].refs++;
+        g_TextureStats.hits++;
+        return it->second;
+    }
+
+    GDK_Internal_MipStream s;
+    s.path = path;
+    s.flags = flags;
+    std::vector<std::vector<uint8_t>> data;
+    bool compressed = GDK_Internal_WantBC(flags);
+    // Probe pass decodes every level; the start window is the tail of that
+    if (!GDK_Internal_MipStreamDecode(s, compressed, 0, -1, data)) return -1;
+    s.start = GDK_Internal_MipStartLevel(s);
+    s.base = s.want = s.hold = s.start;
+
+    uint32_t tid;
+    glGenTextures(1, &tid);
+    glBindTexture(GL_TEXTURE_2D, tid);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int l = s.start; l < s.levels; ++l) GDK_Internal_MipUploadLevel(s, l, data[l].data());
+    GDK_Internal_MipApplyWindow(s);
+    GDK_Internal_ApplyTextureParams(flags);
+    g_TextureStats.misses++;
+
+    size_t bytes = GDK_Internal_MipResidentBytes(s, s.base);
+    int slot = GDK_Internal_AllocTextureSlot(key, tid);
+    g_TextureInfo[slot].bytes = bytes;
+    g_TextureInfo[slot].streamed = true;
+    g_TextureByName[tid] = slot;
+    g_TextureStats.bytes += bytes;
+
+    auto old = g_MipStreams.find(slot); // Freed and reused before the pump noticed
+    if (old != g_MipStreams.end()) GDK_Internal_DropMipStream(old->second);
+    s.gen = g_TextureInfo[slot].gen;
+    s.holdFrame = s.lastUse = GDK::state ? (uint64_t)GDK::state->frameCount : 0;
+    g_MipStreams[slot] = s;
+    g_MipStreamStats.textures = (uint32_t)g_MipStreams.size();
+    g_MipStreamStats.residentBytes += bytes;
+
+    GDK::Internal::AddFrameHook(GDK_Internal_PumpMipStreams);
+    return slot;
+}
+
+GDK_BEGIN_DECLS
+
+// Loads with only the coarse mips resident; finer ones stream in as draws need them.
+// Same index semantics as GDK_LoadTextureEx (Refcounted, free with GDK_FreeTexture).
+GDK_API int GDK_LoadTextureStreamed(const char* path, int flags) {
+    return GDK_Internal_AcquireStreamedTexture(path, flags);
+}
+
+// For custom draw code: the texture is about to cover a sphere of 'radius' (Object units) under the
+// current view matrix. radius <= 0 asks for full detail. GDK_Model_Draw and terrain do this themselves.
+GDK_API void GDK_Texture_Touch(int texIdx, float radius) {
+    GDK_Internal_MipStreamTouch(texIdx, radius);
+}
+
+// VRAM shared by all streamed textures, in MB (Default 256)
+GDK_API void GDK_Texture_SetStreamBudget(int mb) {
+    g_MipStreamBudget = (size_t)std::max(8, mb) * 1024 * 1024;
+}
+
+// Finest resident level of a streamed texture (0 = full detail), -1 if it is not streamed
+GDK_API int GDK_Texture_GetResidentLevel(int texIdx) {
+    GDK_Internal_MipStream* s = GDK_Internal_FindMipStream(texIdx);
+    return s ? s->base : -1;
+}
+
+GDK_API void GDK_Texture_GetStreamStats(GDK_MipStreamStats* out) {
+    if (!out) return;
+    g_MipStreamStats.textures = (uint32_t)g_MipStreams.size();
+    g_MipStreamStats.budgetBytes = g_MipStreamBudget;
+    *out = g_MipStreamStats;
+}
+
+GDK_END_DECLS
+
+#endif // GDK_MIPSTREAM_H
@@ -0,0 +1,306 @@
+#ifndef GDK_MODEL_CACHE_H
+#define GDK_MODEL_CACHE_H
+
+// --- BAKED MODEL CACHE (.gdkm) ---
+// MDL smoothing + normals, MD2 frame decode and MD3 unrolling are deterministic, so the result is
+// written once and memory-mapped on every later load. The key is an FNV-1a hash of the source file's
+// bytes plus a hash of the loader options, so editing the model or a loader constant rebuilds it.
+//
+// Layout (Little endian, no padding):
+//   GDK_GDKM_Header
+//   uint32_t          indices[numIndices]
+//   GDK_Legacy_Vert   frames[numFrames][vertsPerFrame]   (The exact arrays GDK_Model_Draw walks)
+//   GDK_GDKM_Bounds   bounds[numFrames]
+//   GDK_GDKM_Tag      tags[numFrames][numTags]           (MD3 only)
+//   GDK_GDKM_Surface  surfaces[numSurfaces]              (MD3 only)
+//   GDK_GDKM_Prim     strips[numStrips], fans[numFans]   (MD2 GL commands only)
+//   per LOD: GDK_GDKM_LOD, uint32_t source[numVerts], uint32_t indices[numIndices],
+//            GDK_GDKM_Prim surfaceRanges[numSurfaces]   (GDK_MODEL_LOD.h - simplification is the slow part)
+// Textures are not stored - the MDL skin is re-read from the .mdl and MD3 surfaces re-resolve their
+// .skin/shader paths after the read (Cheap, and the texture cache owns them).
+
+#define GDK_GDKM_MAGIC   0x4D4B4447 // 'GDKM'
+#define GDK_GDKM_VERSION 4
+
+#pragma pack(push, 1)
+struct GDK_GDKM_Header {
+    uint32_t magic, version;
+    uint64_t sourceHash;
+    uint32_t options;
+    int32_t type, numTris, numVerts, numFrames, numTags;
+    uint32_t numIndices, vertsPerFrame;
+    uint32_t numSurfaces;
+    uint32_t numStrips, numFans;
+    uint32_t numLods;
+};
+
+struct GDK_GDKM_Bounds { float min[3], max[3], center[3], radius; };
+struct GDK_GDKM_Tag { char name[64]; float pos[3], axis[9]; };
+struct GDK_GDKM_Surface { char name[64], shader[64]; uint32_t firstVert, numVerts; };
+struct GDK_GDKM_Prim { uint32_t first, count; };
+struct GDK_GDKM_LOD { uint32_t numVerts, numIndices; float error; };
+#pragma pack(pop)
+
+static bool g_ModelCache = true;     // GDK_Model_SetCaching
+static std::string g_ModelCacheDir;  // Empty = "<source>.gdkm" next to the source
+
+static uint64_t GDK_Internal_FNV1a(const uint8_t* p, size_t n, uint64_t hash = 1469598103934665603ull) {
+    for (size_t i = 0; i < n; ++i) hash = (hash ^ p[i]) * 1099511628211ull;
+    return hash;
+}
+
+// Loader settings that change the baked output
+static uint32_t GDK_Internal_ModelBakeOptions(int type) {
+    char opts[160];
+    int n;
+    if (type == MDL) n = snprintf(opts, sizeof(opts), "mdl|%g|%g|%d", GDK_MDL_TAUBIN_LAMBDA, GDK_MDL_TAUBIN_MU, GDK_MDL_TAUBIN_ITERATIONS);
+    else n = snprintf(opts, sizeof(opts), "type%d", type);
+    snprintf(opts + n, sizeof(opts) - n, "|lod%d|%d|%d|%g|%g|%g", GDK_LOD_MAX, GDK_LOD_SAMPLE_FRAMES, GDK_LOD_MIN_TRIS,
+             g_LODRatios[0], g_LODRatios[1], g_LODRatios[2]);
+    return (uint32_t)GDK_Internal_FNV1a((const uint8_t*)opts, strlen(opts));
+}
+
+static std::string GDK_Internal_ModelCachePath(const char* path) {
+    if (g_ModelCacheDir.empty()) return std::string(path) + ".gdkm";
+    uint64_t hash = 1469598103934665603ull;
+    for (const char* p = path; *p; ++p) {
+        uint8_t c = (uint8_t)((*p == '\\') ? '/' : tolower((unsigned char)*p));
+        hash = GDK_Internal_FNV1a(&c, 1, hash);
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.gdkm", (unsigned long long)hash);
+    return g_ModelCacheDir + "/" + name;
+}
+
+static void GDK_Internal_ComputeModelBounds(GDK_Legacy_Model& m) {
+    m.frameBounds.resize(m.frames.size());
+    for (size_t f = 0; f < m.frames.size(); ++f)
+        GDK_Internal_ComputeBounds(m.frames[f].data(), m.frames[f].size(), m.frameBounds[f]);
+}
+
+// Hashes the source (Returned for the write that follows a miss) and fills 'm' on a hit.
+// m.type must already be set from the file magic.
+static bool GDK_Internal_ReadModelCache(const char* path, GDK_Legacy_Model& m, uint64_t& sourceHash) {
+    sourceHash = 0;
+    if (!g_ModelCache) return false;
+    {
+        GDK::Internal::MappedFile src;
+        if (!src.Open(path)) return false;
+        sourceHash = GDK_Internal_FNV1a(src.data, src.size);
+    }
+
+    GDK::Internal::MappedFile f;
+    if (!f.Open(GDK_Internal_ModelCachePath(path).c_str()) || f.size < sizeof(GDK_GDKM_Header)) return false;
+    GDK_GDKM_Header hdr;
+    memcpy(&hdr, f.data, sizeof(hdr));
+    if (hdr.magic != GDK_GDKM_MAGIC || hdr.version != GDK_GDKM_VERSION || hdr.sourceHash != sourceHash ||
+        hdr.type != (int32_t)m.type || hdr.options != GDK_Internal_ModelBakeOptions(m.type)) return false;
+    if (hdr.numFrames < 0 || hdr.numTags < 0) return false;
+
+    size_t frameBytes = (size_t)hdr.vertsPerFrame * sizeof(GDK_Legacy_Vert);
+    size_t need = sizeof(hdr) + (size_t)hdr.numIndices * 4 + frameBytes * hdr.numFrames +
+                  sizeof(GDK_GDKM_Bounds) * hdr.numFrames + sizeof(GDK_GDKM_Tag) * hdr.numFrames * hdr.numTags +
+                  sizeof(GDK_GDKM_Surface) * hdr.numSurfaces + sizeof(GDK_GDKM_Prim) * ((size_t)hdr.numStrips + hdr.numFans);
+    if (f.size < need) return false; // Truncated write
+
+    // A bad file past this point must leave 'm' as it came in: the source loader runs next.
+    // Not m.Free() - the caller may already hold defaultTex.
+    auto Fail = [&]() {
+        m.indices.clear(); m.frames.clear(); m.frameBounds.clear(); m.surfaces.clear();
+        m.stripFirst.clear(); m.stripCount.clear(); m.fanFirst.clear(); m.fanCount.clear();
+        m.lods.clear();
+        if (m.hierarchy) { delete m.hierarchy; m.hierarchy = nullptr; }
+        m.numTris = m.numVerts = m.numFrames = m.numTags = 0;
+        return false;
+    };
+
+    const uint8_t* p = f.data + sizeof(hdr);
+    m.numTris = hdr.numTris; m.numVerts = hdr.numVerts; m.numFrames = hdr.numFrames; m.numTags = hdr.numTags;
+    m.indices.resize(hdr.numIndices);
+    memcpy(m.indices.data(), p, (size_t)hdr.numIndices * 4);
+    p += (size_t)hdr.numIndices * 4;
+    for (uint32_t v : m.indices) if (v >= hdr.vertsPerFrame) return Fail();
+
+    m.frames.resize(hdr.numFrames);
+    for (int i = 0; i < hdr.numFrames; ++i) {
+        m.frames[i].resize(hdr.vertsPerFrame);
+        memcpy(m.frames[i].data(), p, frameBytes);
+        p += frameBytes;
+    }
+
+    m.frameBounds.resize(hdr.numFrames);
+    for (int i = 0; i < hdr.numFrames; ++i, p += sizeof(GDK_GDKM_Bounds)) {
+        GDK_GDKM_Bounds b;
+        memcpy(&b, p, sizeof(b));
+        m.frameBounds[i].min = glm::vec3(b.min[0], b.min[1], b.min[2]);
+        m.frameBounds[i].max = glm::vec3(b.max[0], b.max[1], b.max[2]);
+        m.frameBounds[i].center = glm::vec3(b.center[0], b.center[1], b.center[2]);
+        m.frameBounds[i].radius = b.radius;
+    }
+
+    if (hdr.numTags > 0) {
+        if (!m.hierarchy) m.hierarchy = new GDK_MD3_Hierarchy();
+        m.hierarchy->tagFrames.assign(hdr.numFrames, std::vector<GDK_MD3_Tag_Data>(hdr.numTags));
+        m.hierarchy->tagIds.assign(hdr.numTags, -1);
+        for (int i = 0; i < hdr.numFrames; ++i) {
+            for (int j = 0; j < hdr.numTags; ++j, p += sizeof(GDK_GDKM_Tag)) {
+                GDK_GDKM_Tag t;
+                memcpy(&t, p, sizeof(t));
+                GDK_MD3_Tag_Data& d = m.hierarchy->tagFrames[i][j];
+                if (i == 0) m.hierarchy->tagIds[j] = GDK_Internal_InternTag(std::string(t.name, strnlen(t.name, sizeof(t.name))));
+                d.pos = glm::vec3(t.pos[0], t.pos[1], t.pos[2]);
+                for (int k = 0; k < 9; ++k) d.axis[k / 3][k % 3] = t.axis[k];
+            }
+        }
+    } else if (m.type == MD3) {
+        // Loader always gives MD3 a hierarchy, even tagless
+        if (!m.hierarchy) m.hierarchy = new GDK_MD3_Hierarchy();
+        m.hierarchy->tagFrames.assign(hdr.numFrames, std::vector<GDK_MD3_Tag_Data>());
+    }
+
+    m.surfaces.resize(hdr.numSurfaces);
+    for (uint32_t i = 0; i < hdr.numSurfaces; ++i, p += sizeof(GDK_GDKM_Surface)) {
+        GDK_GDKM_Surface s;
+        memcpy(&s, p, sizeof(s));
+        m.surfaces[i].name = std::string(s.name, strnlen(s.name, sizeof(s.name)));
+        m.surfaces[i].shader = std::string(s.shader, strnlen(s.shader, sizeof(s.shader)));
+        m.surfaces[i].firstVert = s.firstVert;
+        m.surfaces[i].numVerts = s.numVerts;
+        m.surfaces[i].texture = 0;
+        if ((uint64_t)s.firstVert + s.numVerts > hdr.vertsPerFrame) return Fail();
+    }
+
+    auto ReadPrims = [&](uint32_t n, std::vector<GLint>& first, std::vector<GLsizei>& count) {
+        first.resize(n); count.resize(n);
+        for (uint32_t i = 0; i < n; ++i, p += sizeof(GDK_GDKM_Prim)) {
+            GDK_GDKM_Prim pr;
+            memcpy(&pr, p, sizeof(pr));
+            first[i] = (GLint)pr.first;
+            count[i] = (GLsizei)pr.count;
+        }
+    };
+    ReadPrims(hdr.numStrips, m.stripFirst, m.stripCount);
+    ReadPrims(hdr.numFans, m.fanFirst, m.fanCount);
+
+    m.lods.clear();
+    const uint8_t* end = f.data + f.size;
+    for (uint32_t l = 0; l < hdr.numLods && l < GDK_LOD_MAX; ++l) {
+        GDK_GDKM_LOD lh;
+        if ((size_t)(end - p) < sizeof(lh)) return Fail();
+        memcpy(&lh, p, sizeof(lh));
+        p += sizeof(lh);
+        size_t bytes = ((size_t)lh.numVerts + lh.numIndices) * 4 + sizeof(GDK_GDKM_Prim) * hdr.numSurfaces;
+        if ((size_t)(end - p) < bytes) return Fail();
+
+        GDK_Legacy_LOD lod;
+        lod.error = lh.error;
+        lod.source.resize(lh.numVerts);
+        memcpy(lod.source.data(), p, (size_t)lh.numVerts * 4);
+        p += (size_t)lh.numVerts * 4;
+        lod.indices.resize(lh.numIndices);
+        memcpy(lod.indices.data(), p, (size_t)lh.numIndices * 4);
+        p += (size_t)lh.numIndices * 4;
+        for (uint32_t i = 0; i < hdr.numSurfaces; ++i, p += sizeof(GDK_GDKM_Prim)) {
+            GDK_GDKM_Prim pr;
+            memcpy(&pr, p, sizeof(pr));
+            m.surfaces[i].lodFirst[l] = pr.first;
+            m.surfaces[i].lodCount[l] = pr.count;
+            if ((uint64_t)pr.first + pr.count > lh.numIndices) return Fail();
+        }
+        for (uint32_t v : lod.source) if (v >= hdr.vertsPerFrame) return Fail();
+        for (uint32_t v : lod.indices) if (v >= lh.numVerts) return Fail();
+        m.lods.push_back(std::move(lod));
+    }
+    return true;
+}
+
+static bool GDK_Internal_WriteModelCache(const char* path, const GDK_Legacy_Model& m, uint64_t sourceHash) {
+    if (!g_ModelCache || sourceHash == 0) return false;
+    uint32_t vertsPerFrame = m.frames.empty() ? 0 : (uint32_t)m.frames[0].size();
+    for (const auto& fr : m.frames) if (fr.size() != vertsPerFrame) return false; // Ragged - not a format we bake
+    int numTags = (m.hierarchy && !m.hierarchy->tagFrames.empty()) ? (int)m.hierarchy->tagFrames[0].size() : 0;
+
+    GDK_GDKM_Header hdr = {};
+    hdr.magic = GDK_GDKM_MAGIC;
+    hdr.version = GDK_GDKM_VERSION;
+    hdr.sourceHash = sourceHash;
+    hdr.options = GDK_Internal_ModelBakeOptions(m.type);
+    hdr.type = m.type;
+    hdr.numTris = m.numTris; hdr.numVerts = m.numVerts;
+    hdr.numFrames = (int32_t)m.frames.size(); hdr.numTags = numTags;
+    hdr.numIndices = (uint32_t)m.indices.size();
+    hdr.vertsPerFrame = vertsPerFrame;
+    hdr.numSurfaces = (uint32_t)m.surfaces.size();
+    hdr.numStrips = (uint32_t)m.stripFirst.size();
+    hdr.numFans = (uint32_t)m.fanFirst.size();
+    hdr.numLods = (uint32_t)m.lods.size();
+
+    if (!g_ModelCacheDir.empty()) CreateDirectoryA(g_ModelCacheDir.c_str(), NULL);
+    std::string out = GDK_Internal_ModelCachePath(path);
+    FILE* f = fopen(out.c_str(), "wb");
+    if (!f) return false; // Read-only install - we just re-process next time
+
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    if (ok && !m.indices.empty()) ok = fwrite(m.indices.data(), 4, m.indices.size(), f) == m.indices.size();
+    for (const auto& fr : m.frames) {
+        if (ok && vertsPerFrame) ok = fwrite(fr.data(), sizeof(GDK_Legacy_Vert), fr.size(), f) == fr.size();
+    }
+    for (size_t i = 0; ok && i < m.frames.size(); ++i) {
+        const GDK_Legacy_Bounds& src = m.frameBounds[i];
+        GDK_GDKM_Bounds b = { { src.min.x, src.min.y, src.min.z }, { src.max.x, src.max.y, src.max.z },
+                              { src.center.x, src.center.y, src.center.z }, src.radius };
+        ok = fwrite(&b, sizeof(b), 1, f) == 1;
+    }
+    for (int i = 0; ok && numTags && i < hdr.numFrames; ++i) {
+        for (int j = 0; ok && j < numTags; ++j) {
+            const GDK_MD3_Tag_Data& d = m.hierarchy->tagFrames[i][j];
+            GDK_GDKM_Tag t = {};
+            strncpy(t.name, g_TagNames[m.hierarchy->tagIds[j]].c_str(), sizeof(t.name) - 1);
+            t.pos[0] = d.pos.x; t.pos[1] = d.pos.y; t.pos[2] = d.pos.z;
+            for (int k = 0; k < 9; ++k) t.axis[k] = d.axis[k / 3][k % 3];
+            ok = fwrite(&t, sizeof(t), 1, f) == 1;
+        }
+    }
+    for (size_t i = 0; ok && i < m.surfaces.size(); ++i) {
+        GDK_GDKM_Surface s = {};
+        strncpy(s.name, m.surfaces[i].name.c_str(), sizeof(s.name) - 1);
+        strncpy(s.shader, m.surfaces[i].shader.c_str(), sizeof(s.shader) - 1);
+        s.firstVert = m.surfaces[i].firstVert;
+        s.numVerts = m.surfaces[i].numVerts;
+        ok = fwrite(&s, sizeof(s), 1, f) == 1;
+    }
+    for (size_t i = 0; ok && i < m.stripFirst.size(); ++i) {
+        GDK_GDKM_Prim pr = { (uint32_t)m.stripFirst[i], (uint32_t)m.stripCount[i] };
+        ok = fwrite(&pr, sizeof(pr), 1, f) == 1;
+    }
+    for (size_t i = 0; ok && i < m.fanFirst.size(); ++i) {
+        GDK_GDKM_Prim pr = { (uint32_t)m.fanFirst[i], (uint32_t)m.fanCount[i] };
+        ok = fwrite(&pr, sizeof(pr), 1, f) == 1;
+    }
+    for (size_t l = 0; ok && l < m.lods.size(); ++l) {
+        const GDK_Legacy_LOD& lod = m.lods[l];
+        GDK_GDKM_LOD lh = { (uint32_t)lod.source.size(), (uint32_t)lod.indices.size(), lod.error };
+        ok = fwrite(&lh, sizeof(lh), 1, f) == 1;
+        if (ok && !lod.source.empty()) ok = fwrite(lod.source.data(), 4, lod.source.size(), f) == lod.source.size();
+        if (ok && !lod.indices.empty()) ok = fwrite(lod.indices.data(), 4, lod.indices.size(), f) == lod.indices.size();
+        for (size_t i = 0; ok && i < m.surfaces.size(); ++i) {
+            GDK_GDKM_Prim pr = { m.surfaces[i].lodFirst[l], m.surfaces[i].lodCount[l] };
+            ok = fwrite(&pr, sizeof(pr), 1, f) == 1;
+        }
+    }
+    fclose(f);
+    if (!ok) remove(out.c_str());
+    return ok;
+}
+
+GDK_BEGIN_DECLS
+
+// Global switch (Default on). Off = every load re-processes the source.
+GDK_API void GDK_Model_SetCaching(int enable) { g_ModelCache = (enable != 0); }
+
+// Where .gdkm files go. NULL/"" = next to each source model.
+GDK_API void GDK_Model_SetCacheDir(const char* dir) { g_ModelCacheDir = dir ? dir : ""; }
+
+GDK_END_DECLS
+
+#endif // GDK_MODEL_CACHE_H
@@ -1,242 +1,779 @@
-#ifndef GDK_MODEL_ENGINE_H
-#define GDK_MODEL_ENGINE_H
-
-
-// --- 1. THE UNIFIED REGISTRY ---
-
-struct GDK_Model_Master {
-    int TypeID;        // GDK_ModelType ID
-    int InternalIndex; // Index within the type-specific storage array
-};
-
-static std::vector<GDK_Model_Master> gdk_models; // The Universal Master Registry
-
-// --- 2. THE UNIVERSAL LOADER ---
-GDK_BEGIN_DECLS
-
-static int GDK_Internal_GetFreeLegacySlot() {
-    // 1. Look for an empty hole to reuse memory
-    for (int i = 0; i < (int)g_ModelStore.size(); ++i) {
-        if (!g_ModelStore[i].InUse) return i;
-    }
-    // 2. If no holes, expand the vector
-    g_ModelStore.push_back(GDK_Legacy_Model());
-    return (int)g_ModelStore.size() - 1;
-}
-
-// Returns the number of frames (MDL/MD2/MD3) or meshes (OBJ) in the model
-GDK_API int GDK_Model_Get_Frames(int mIdx) {
-    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return 0;
-    auto& master = gdk_models[mIdx];
-    if (master.TypeID >= MDL && master.TypeID <= MD3) {
-        return g_ModelStore[master.InternalIndex].numFrames;
-    }
-    return 1; // OBJ/STL usually 1 frame
-}
-
-GDK_API void GDK_Model_AddAnim(int mIdx, int tag, int start, int end, float fps) {
-    // 1. Check if the Master Index is valid
-    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return;
-
-    // 2. Get the pointer to our internal storage index
-    GDK_Model_Master &master = gdk_models[mIdx];
-
-    // 3. Routing: Only legacy models (MDL, MD2, MD3) use g_ModelStore
-    if (master.TypeID == MDL || master.TypeID == MD2 || master.TypeID == MD3) {
-        
-        int internalIdx = master.InternalIndex;
-        
-        // Safety check on the internal legacy array
-        if (internalIdx < 0 || (size_t)internalIdx >= g_ModelStore.size()) return;
-
-        GDK_Legacy_Model &m = g_ModelStore[internalIdx];
-
-        // 4. Populate the animation data
-        GDK_Animation a;
-        a.Start    = start; 
-        a.End      = end; 
-        a.Current  = start;
-        a.Speed    = fps; 
-        a.Timer    = 0.0f; 
-        a.Lerp     = 0.0f; 
-        a.Looping  = true; 
-        a.Priority = 0;
-
-        // 5. Save it into the routed model's library
-        m.animLibrary[tag] = a;
-        m.NumAnims = (int)m.animLibrary.size();
-    }
-    // Else: If you later add FBX or GLTF to a different store, you'd add another 'else if' here
-}
-
-GDK_API int GDK_Model_Load(const char* mPath, const char* tPath) {
-    std::string p = mPath;
-    bool success = false;
-    GDK_Model_Master masterRecord = { TYPE_NONE, -1 };
-
-    // --- 1. EXTENSION SNIFF (Prioritise Loose/Static Formats) ---
-    if (p.find(".stl") != std::string::npos || p.find(".STL") != std::string::npos) {
-    int slot = GDK_Internal_GetFreeSTLSlot(); // <--- CLEAN
-    GDK_STL_Model& m = g_STLStore[slot];
-    m.Free();
-
-    if (GDK_Internal_LoadSTL(mPath, m)) {
-        m.InUse = true;
-        masterRecord.TypeID = STL;
-        masterRecord.InternalIndex = slot;
-        success = true;
-    }
-    }
-    else if (p.find(".txt") != std::string::npos) {
-        // Let the loader find the slot and do the heavy lifting
-        int slot = PRM::PRM_LoadRevoltCar(mPath); 
-        
-        if (slot != -1) {
-            // Success! slot is the index of the newly loaded car
-            masterRecord.TypeID = REVOLT; 
-            masterRecord.InternalIndex = slot;
-            success = true;
-        } else {
-            // Fail - likely file not found or mesh load error
-            success = false;
-        }
-    }
-
-    // --- 2. MAGIC SNIFF (For Legacy Binary Formats) ---
-    else {
-        std::ifstream file(mPath, std::ios::binary);
-        if (!file) return -1;
-        char magic[4] = {0};
-        file.read(magic, 4);
-        file.close();
-
-        if (strncmp(magic, "IDPO", 4) == 0 || strncmp(magic, "IDST", 4) == 0 || 
-            strncmp(magic, "IDP2", 4) == 0 || strncmp(magic, "IDP3", 4) == 0) {
-            
-            int internalIdx = GDK_Internal_GetFreeLegacySlot();
-            GDK_Legacy_Model& m = g_ModelStore[internalIdx];
-            m.Free();
-
-            if (tPath && strlen(tPath) > 0) {
-                GDK_LoadTexture(tPath, (int&)m.defaultTex);
-            }
-            
-            if (strncmp(magic, "IDP2", 4) == 0) {
-                m.type = MD2;
-                success = GDK_Internal_LoadMD2(mPath, m);
-            } else if (strncmp(magic, "IDP3", 4) == 0) {
-                m.type = MD3;
-                success = GDK_Internal_LoadMD3(mPath, m);
-            } else {
-                m.type = MDL;
-                success = GDK_Internal_LoadMDL(mPath, m); 
-            }
-
-            if (success) {
-                m.InUse = true;
-                masterRecord.TypeID = m.type;
-                masterRecord.InternalIndex = internalIdx;
-            }
-        }
-    }
-
-    if (!success) return -1;
-
-    // --- 3. MASTER RECORD REUSE ---
-    int masterIdx = -1;
-    for (int i = 0; i < (int)gdk_models.size(); ++i) {
-        if (gdk_models[i].TypeID == TYPE_NONE) { masterIdx = i; break; }
-    }
-    if (masterIdx == -1) {
-        gdk_models.push_back(masterRecord);
-        masterIdx = (int)gdk_models.size() - 1;
-    } else {
-        gdk_models[masterIdx] = masterRecord;
-    }
-
-    return masterIdx; 
-}
-
-
-// --- 3. THE UNIVERSAL DRAW ---
-GDK_API void GDK_Model_Draw(int mIdx, int texOverride, int frameOrMesh) {
-    // 1. Master Index Safety
-    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return;
-    
-    GDK_Model_Master& master = gdk_models[mIdx];
-
-    switch (master.TypeID) {
-        case MDL: 
-        case MD2: 
-        case MD3: {
-            // Check internal legacy storage
-            if (master.InternalIndex < 0 || (size_t)master.InternalIndex >= g_ModelStore.size()) return;
-            GDK_Legacy_Model& m = g_ModelStore[master.InternalIndex];
-
-            // Safety: Don't draw if not in use or if frames weren't loaded
-            if (!m.InUse || m.frames.empty()) return;
-
-            // Frame selection logic
-            int f = (frameOrMesh < 0) ? 0 : frameOrMesh % m.numFrames;
-            if (f >= (int)m.frames.size()) f = 0;
-            
-            // Texture Resolution
-            uint32_t activeID = 0;
-            if (texOverride >= 0 && (size_t)texOverride < g_Textures.size()) {
-                activeID = g_Textures[texOverride];
-            } else {
-                activeID = (uint32_t)m.defaultTex;
-            }
-
-            if (activeID > 0) {
-                glEnable(GL_TEXTURE_2D);
-                glBindTexture(GL_TEXTURE_2D, activeID);
-            }
-
-            // Draw unrolled frames
-            glBegin(GL_TRIANGLES);
-            for (const auto& v : m.frames[f]) {
-                glNormal3f(v.nx, v.ny, v.nz);   
-                glTexCoord2f(v.u, v.v);        
-                glVertex3f(v.x, v.y, v.z);     
-            }
-            glEnd();
-            
-            if (activeID > 0) glDisable(GL_TEXTURE_2D);
-        } break;
-
-        case STL: {
-            // Direct call to the simplified STL renderer
-            GDK_Internal_STL_Draw(master.InternalIndex);
-        } break;
-        case REVOLT: {
-            PRM::PRM_Draw(master.InternalIndex);
-        } break;
-
-        default:
-            // Placeholder for OBJ/other future types
-            break;
-    }
-}
-
-
-GDK_API void GDK_Model_Free(int mIdx) {
-    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return;
-    
-    GDK_Model_Master& master = gdk_models[mIdx];
-    
-    // Only legacy models (MDL, MD2, MD3) currently use g_ModelStore
-    if (master.TypeID == MDL || master.TypeID == MD2 || master.TypeID == MD3) {
-        if (master.InternalIndex >= 0 && (size_t)master.InternalIndex < g_ModelStore.size()) {
-            g_ModelStore[master.InternalIndex].Free();
-        }
-    }
-    
-    // Mark the Master Record as empty so it can be reused too
-    master.TypeID = TYPE_NONE;
-    master.InternalIndex = -1;
-}
-
-
-GDK_END_DECLS
-#endif
+#ifndef GDK_MODEL_ENGINE_H
+#define GDK_MODEL_ENGINE_H
+
+
+// --- 1. THE UNIFIED REGISTRY ---
+
+struct GDK_Model_Master {
+    int TypeID;        // GDK_ModelType ID
+    int InternalIndex; // Index within the type-specific storage array
+};
+
+static std::vector<GDK_Model_Master> gdk_models; // The Universal Master Registry
+
+// --- 2. THE UNIVERSAL LOADER ---
+GDK_BEGIN_DECLS
+
+static int GDK_Internal_GetFreeLegacySlot() {
+    // 1. Look for an empty hole to reuse memory
+    for (int i = 0; i < (int)g_ModelStore.size(); ++i) {
+        if (!g_ModelStore[i].InUse) return i;
+    }
+    // 2. If no holes, expand the vector
+    g_ModelStore.push_back(GDK_Legacy_Model());
+    return (int)g_ModelStore.size() - 1;
+}
+
+// Returns the number of frames (MDL/MD2/MD3) or meshes (OBJ) in the model
+GDK_API int GDK_Model_Get_Frames(int mIdx) {
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return 0;
+    auto& master = gdk_models[mIdx];
+    if (master.TypeID >= MDL && master.TypeID <= MD3) {
+        return g_ModelStore[master.InternalIndex].numFrames;
+    }
+    return 1; // OBJ/STL usually 1 frame
+}
+
+// Interned ID for a tag name ("tag_torso", "tag_weapon"...). IDs are shared by every model - look up once.
+GDK_API int GDK_Model_GetTagID(const char* name) {
+    if (!name || !*name) return -1;
+    return GDK_Internal_InternTag(name);
+}
+
+// Model-space matrix (16 floats, column major) of a tag blended between two frames.
+// Returns 0 (And identity) if the model has no such tag.
+GDK_API int GDK_Model_GetTagMatrix(int mIdx, int tagId, int frameA, int frameB, float lerp, float* out16) {
+    glm::mat4 m(1.0f);
+    bool found = false;
+    if (mIdx >= 0 && (size_t)mIdx < gdk_models.size() && gdk_models[mIdx].TypeID == MD3) {
+        int internalIdx = gdk_models[mIdx].InternalIndex;
+        if (internalIdx >= 0 && (size_t)internalIdx < g_ModelStore.size())
+            found = GDK_Internal_MD3TagMatrix(g_ModelStore[internalIdx], tagId, frameA, frameB, lerp, m);
+    }
+    if (out16) memcpy(out16, glm::value_ptr(m), sizeof(float) * 16);
+    return found ? 1 : 0;
+}
+
+GDK_API void GDK_Model_AddAnim(int mIdx, int tag, int start, int end, float fps) {
+    // 1. Check if the Master Index is valid
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return;
+
+    // 2. Get the pointer to our internal storage index
+    GDK_Model_Master &master = gdk_models[mIdx];
+
+    // 3. Routing: Only legacy models (MDL, MD2, MD3) use g_ModelStore
+    if (master.TypeID == MDL || master.TypeID == MD2 || master.TypeID == MD3) {
+        
+        int internalIdx = master.InternalIndex;
+        
+        // Safety check on the internal legacy array
+        if (internalIdx < 0 || (size_t)internalIdx >= g_ModelStore.size()) return;
+
+        GDK_Legacy_Model &m = g_ModelStore[internalIdx];
+
+        // 4. Populate the animation data
+        GDK_Animation a;
+        a.Start    = start; 
+        a.End      = end; 
+        a.Current  = start;
+        a.Speed    = fps; 
+        a.Timer    = 0.0f; 
+        a.Lerp     = 0.0f; 
+        a.Looping  = true; 
+        a.Priority = 0;
+
+        // 5. Save it into the routed model's library
+        m.animLibrary[tag] = a;
+        m.NumAnims = (int)m.animLibrary.size();
+    }
+    // Else: If you later add FBX or GLTF to a different store, you'd add another 'else if' here
+}
+
+GDK_API int GDK_Model_Load(const char* mPath, const char* tPath) {
+    std::string p = mPath;
+    bool success = false;
+    GDK_Model_Master masterRecord = { TYPE_NONE, -1 };
+
+    // --- 1. EXTENSION SNIFF (Prioritise Loose/Static Formats) ---
+    if (p.find(".stl") != std::string::npos || p.find(".STL") != std::string::npos) {
+    int slot = GDK_Internal_GetFreeSTLSlot(); // <--- CLEAN
+    GDK_STL_Model& m = g_STLStore[slot];
+    m.Free();
+
+    if (GDK_Internal_LoadSTL(mPath, m)) {
+        GDK_Internal_BuildSTLLODs(m);
+        m.InUse = true;
+        masterRecord.TypeID = STL;
+        masterRecord.InternalIndex = slot;
+        success = true;
+    }
+    }
+    else if (p.find(".txt") != std::string::npos) {
+        // Let the loader find the slot and do the heavy lifting
+        int slot = PRM::PRM_LoadRevoltCar(mPath); 
+        
+        if (slot != -1) {
+            // Success! slot is the index of the newly loaded car
+            masterRecord.TypeID = REVOLT; 
+            masterRecord.InternalIndex = slot;
+            success = true;
+        } else {
+            // Fail - likely file not found or mesh load error
+            success = false;
+        }
+    }
+
+    // --- 2. MAGIC SNIFF (For Legacy Binary Formats) ---
+    else {
+        std::ifstream file(mPath, std::ios::binary);
+        if (!file) return -1;
+        char magic[4] = {0};
+        file.read(magic, 4);
+        file.close();
+
+        if (strncmp(magic, "IDPO", 4) == 0 || strncmp(magic, "IDST", 4) == 0 || 
+            strncmp(magic, "IDP2", 4) == 0 || strncmp(magic, "IDP3", 4) == 0) {
+            
+            int internalIdx = GDK_Internal_GetFreeLegacySlot();
+            GDK_Legacy_Model& m = g_ModelStore[internalIdx];
+            m.Free();
+
+            if (tPath && strlen(tPath) > 0) {
+                GDK_LoadTexture(tPath, (int&)m.defaultTex);
+            }
+            
+            if (strncmp(magic, "IDP2", 4) == 0) m.type = MD2;
+            else if (strncmp(magic, "IDP3", 4) == 0) m.type = MD3;
+            else m.type = MDL;
+
+            // Baked .gdkm first - the MDL skin still comes from the source file
+            uint64_t srcHash = 0;
+            if (GDK_Internal_ReadModelCache(mPath, m, srcHash)) {
+                success = (m.type != MDL) || GDK_Internal_LoadMDLSkinOnly(mPath, m);
+                if (m.type == MD3) GDK_Internal_MD3BindSurfaces(mPath, m);
+            } else {
+                if (m.type == MD2) success = GDK_Internal_LoadMD2(mPath, m);
+                else if (m.type == MD3) success = GDK_Internal_LoadMD3(mPath, m);
+                else success = GDK_Internal_LoadMDL(mPath, m); 
+
+                if (success) {
+                    GDK_Internal_ComputeModelBounds(m);
+                    GDK_Internal_BuildLegacyLODs(m);
+                    GDK_Internal_WriteModelCache(mPath, m, srcHash);
+                }
+            }
+
+            if (success) {
+                GDK_Internal_GatherLODFrames(m);
+                m.InUse = true;
+                masterRecord.TypeID = m.type;
+                masterRecord.InternalIndex = internalIdx;
+            }
+        }
+    }
+
+    if (!success) return -1;
+
+    // --- 3. MASTER RECORD REUSE ---
+    int masterIdx = -1;
+    for (int i = 0; i < (int)gdk_models.size(); ++i) {
+        if (gdk_models[i].TypeID == TYPE_NONE) { masterIdx = i; break; }
+    }
+    if (masterIdx == -1) {
+        gdk_models.push_back(masterRecord);
+        masterIdx = (int)gdk_models.size() - 1;
+    } else {
+        gdk_models[masterIdx] = masterRecord;
+    }
+
+    return masterIdx; 
+}
+
+
+static GDK_Legacy_Model* GDK_Internal_GetLegacyModel(int mIdx) {
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return nullptr;
+    const GDK_Model_Master& master = gdk_models[mIdx];
+    if (master.TypeID < MDL || master.TypeID > MD3) return nullptr;
+    if (master.InternalIndex < 0 || (size_t)master.InternalIndex >= g_ModelStore.size()) return nullptr;
+    GDK_Legacy_Model& m = g_ModelStore[master.InternalIndex];
+    // Safety: Don't draw if not in use or if frames weren't loaded
+    return (m.InUse && !m.frames.empty()) ? &m : nullptr;
+}
+
+// Frame selection logic
+static int GDK_Internal_LegacyFrame(const GDK_Legacy_Model& m, int frame) {
+    int f = (frame < 0 || m.numFrames <= 0) ? 0 : frame % m.numFrames;
+    return (f >= (int)m.frames.size()) ? 0 : f;
+}
+
+// --- FRUSTUM CULLING ---
+// Optional (GDK_Model_SetCulling). Planes come from projection * view, and view is the live modelview
+// (GDK_Translate etc. write into it), so the test runs on the model-space box - no per-vertex work.
+
+struct GDK_ModelBounds {
+    float min[3], max[3], center[3];
+    float radius;
+};
+
+struct GDK_ModelCullStats {
+    uint32_t tested;   // Draws that ran the test (Last completed frame)
+    uint32_t culled;   // ...of which were skipped
+};
+
+static bool g_ModelCulling = false;
+static GDK_ModelCullStats g_ModelCullFrame = {};  // Counting
+static GDK_ModelCullStats g_ModelCullLast = {};   // Reported
+
+static void GDK_Internal_ModelCullFrame() {
+    g_ModelCullLast = g_ModelCullFrame;
+    g_ModelCullFrame = GDK_ModelCullStats();
+}
+
+// True if the model-space box is entirely outside the current frustum (Counted in the cull stats)
+static bool GDK_Internal_CullBox(const glm::vec3& mn, const glm::vec3& mx) {
+    if (!g_ModelCulling || !GDK::state) return false;
+    g_ModelCullFrame.tested++;
+    glm::mat4 clip = GDK::state->projection * GDK::state->view;
+    glm::vec4 row[4];
+    for (int i = 0; i < 4; ++i) row[i] = glm::vec4(clip[0][i], clip[1][i], clip[2][i], clip[3][i]);
+
+    for (int p = 0; p < 6; ++p) {
+        glm::vec4 pl = (p & 1) ? row[3] - row[p >> 1] : row[3] + row[p >> 1]; // Left, right, bottom, top, near, far
+        // Box corner furthest along the plane normal - if even that is behind, the whole box is
+        glm::vec3 v(pl.x >= 0.0f ? mx.x : mn.x, pl.y >= 0.0f ? mx.y : mn.y, pl.z >= 0.0f ? mx.z : mn.z);
+        if (pl.x * v.x + pl.y * v.y + pl.z * v.z + pl.w < 0.0f) {
+            g_ModelCullFrame.culled++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Bounds of any model type at a frame (STL and PRM have one)
+static bool GDK_Internal_ModelBounds(int mIdx, int frame, GDK_Legacy_Bounds& out) {
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return false;
+    const GDK_Model_Master& master = gdk_models[mIdx];
+    switch (master.TypeID) {
+        case MDL:
+        case MD2:
+        case MD3: {
+            GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(mIdx);
+            if (!m) return false;
+            if (m->frameBounds.size() != m->frames.size()) GDK_Internal_ComputeModelBounds(*m);
+            out = m->frameBounds[GDK_Internal_LegacyFrame(*m, frame)];
+            return true;
+        }
+        case STL: {
+            if (master.InternalIndex < 0 || (size_t)master.InternalIndex >= g_STLStore.size()) return false;
+            const GDK_STL_Model& m = g_STLStore[master.InternalIndex];
+            if (!m.InUse || m.vertices.empty()) return false;
+            out = m.bounds;
+            return true;
+        }
+        case REVOLT:
+            return PRM::PRM_GetBounds(master.InternalIndex, out);
+        default:
+            return false;
+    }
+}
+
+// Core profile path: stream the drawn vertices into the model's VBO. 'key' identifies the frame and
+// LOD (Upload skipped while the same one is redrawn) or is -1 for blended data, which always uploads.
+// Attribute layout matches the terrain: 0 = position, 1 = normal, 2 = UV.
+static void GDK_Internal_LegacyModelUpload(GDK_Legacy_Model& m, const std::vector<GDK_Legacy_Vert>& verts, int key) {
+    if (!m.vao) {
+        glGenVertexArrays(1, &m.vao);
+        glGenBuffers(1, &m.vbo);
+        glBindVertexArray(m.vao);
+        glBindBuffer(GL_ARRAY_BUFFER, m.vbo);
+        glEnableVertexAttribArray(0); // Pos
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GDK_Legacy_Vert), (void*)offsetof(GDK_Legacy_Vert, x));
+        glEnableVertexAttribArray(1); // Normal
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(GDK_Legacy_Vert), (void*)offsetof(GDK_Legacy_Vert, nx));
+        glEnableVertexAttribArray(2); // Tex
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GDK_Legacy_Vert), (void*)offsetof(GDK_Legacy_Vert, u));
+        m.vboFrame = -1;
+    }
+    glBindVertexArray(m.vao);
+    if (key < 0 || m.vboFrame != key) {
+        glBindBuffer(GL_ARRAY_BUFFER, m.vbo);
+        glBufferData(GL_ARRAY_BUFFER, verts.size() * sizeof(GDK_Legacy_Vert), verts.data(), GL_STREAM_DRAW); // Orphans the old frame
+        m.vboFrame = key;
+    }
+}
+
+// Draws one set of vertices laid out like m.frames[] - or m.lods[lod].frames[] when lod >= 0 (A keyframe,
+// or a blend of two; 'key' is the frame or -1 for blended). Legacy mode submits client arrays, modern
+// modes the VBO - same primitives either way.
+static void GDK_Internal_DrawLegacyModel(GDK_Legacy_Model& m, int texOverride, const std::vector<GDK_Legacy_Vert>& verts, int key, int lod = -1) {
+    GDK_Legacy_LOD* level = (lod >= 0 && (size_t)lod < m.lods.size()) ? &m.lods[lod] : nullptr;
+
+    // Texture Resolution - an override (Or a model without per-surface materials) is one draw
+    uint32_t activeID = 0;
+    bool perSurface = texOverride < 0 && !m.surfaces.empty();
+    if (texOverride >= 0 && (size_t)texOverride < g_Textures.size()) {
+        activeID = g_Textures[texOverride];
+    } else {
+        activeID = (uint32_t)m.defaultTex;
+    }
+
+    // Feed the mip streamer how big this model is on screen
+    if (!g_MipStreams.empty() && m.radius < 0.0f) {
+        float r2 = 0.0f;
+        for (const auto& fr : m.frames)
+            for (const auto& v : fr) r2 = std::max(r2, v.x * v.x + v.y * v.y + v.z * v.z);
+        m.radius = std::sqrt(r2);
+    }
+
+    bool modern = (GDK::mode != GDK_MODE_LEGACY);
+    if (modern) {
+        GDK_Internal_LegacyModelUpload(m, verts, key < 0 ? -1 : (key << 3) | (lod + 1));
+        if (level) {
+            // The element binding is VAO state - rebind per draw since the levels share one VAO
+            if (!level->ebo) {
+                glGenBuffers(1, &level->ebo);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, level->ebo);
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, level->indices.size() * 4, level->indices.data(), GL_STATIC_DRAW);
+            }
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, level->ebo);
+        }
+    } else {
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glVertexPointer(3, GL_FLOAT, sizeof(GDK_Legacy_Vert), &verts[0].x);
+        glNormalPointer(GL_FLOAT, sizeof(GDK_Legacy_Vert), &verts[0].nx);
+        glTexCoordPointer(2, GL_FLOAT, sizeof(GDK_Legacy_Vert), &verts[0].u);
+    }
+
+    auto Bind = [&](uint32_t tid) {
+        if (tid == 0) return;
+        if (!g_MipStreams.empty()) {
+            if (texOverride >= 0) GDK_Internal_MipStreamTouch(texOverride, m.radius);
+            else GDK_Internal_MipStreamTouchName(tid, m.radius);
+        }
+        if (!modern) glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, tid);
+    };
+    auto Unbind = [&](uint32_t tid) {
+        if (tid > 0 && !modern) glDisable(GL_TEXTURE_2D);
+    };
+
+    // Index offsets: byte offsets into the EBO, or client pointers in legacy mode
+    auto Indices = [&](uint32_t first) -> const void* {
+        return modern ? (const void*)((size_t)first * 4) : (const void*)(level->indices.data() + first);
+    };
+
+    if (level && !perSurface) {
+        // Simplified level: one indexed list, whatever the full mesh was made of
+        Bind(activeID);
+        glDrawElements(GL_TRIANGLES, (GLsizei)level->indices.size(), GL_UNSIGNED_INT, Indices(0));
+        Unbind(activeID);
+    } else if (level) {
+        std::vector<const void*> offs;
+        std::vector<GLsizei> count;
+        for (size_t s = 0; s < m.surfaces.size();) {
+            uint32_t tid = m.surfaces[s].texture ? m.surfaces[s].texture : activeID;
+            offs.clear(); count.clear();
+            for (; s < m.surfaces.size(); ++s) {
+                const GDK_Legacy_Surface& surf = m.surfaces[s];
+                if ((surf.texture ? surf.texture : activeID) != tid) break;
+                if (!surf.lodCount[lod]) continue;
+                offs.push_back(Indices(surf.lodFirst[lod]));
+                count.push_back((GLsizei)surf.lodCount[lod]);
+            }
+            Bind(tid);
+            if (!offs.empty()) glMultiDrawElements(GL_TRIANGLES, count.data(), GL_UNSIGNED_INT, offs.data(), (GLsizei)offs.size());
+            Unbind(tid);
+        }
+    } else if (!m.stripFirst.empty() || !m.fanFirst.empty()) {
+        // MD2 GL commands: all strips in one call, all fans in another
+        Bind(activeID);
+        if (!m.stripFirst.empty())
+            glMultiDrawArrays(GL_TRIANGLE_STRIP, m.stripFirst.data(), m.stripCount.data(), (GLsizei)m.stripFirst.size());
+        if (!m.fanFirst.empty())
+            glMultiDrawArrays(GL_TRIANGLE_FAN, m.fanFirst.data(), m.fanCount.data(), (GLsizei)m.fanFirst.size());
+        Unbind(activeID);
+    } else if (!perSurface) {
+        // Draw unrolled frames
+        Bind(activeID);
+        glDrawArrays(GL_TRIANGLES, 0, (GLsizei)verts.size());
+        Unbind(activeID);
+    } else {
+        // Surfaces are sorted by texture - one bind and one multi-draw per material run
+        std::vector<GLint> first;
+        std::vector<GLsizei> count;
+        for (size_t s = 0; s < m.surfaces.size();) {
+            uint32_t tid = m.surfaces[s].texture ? m.surfaces[s].texture : activeID;
+            first.clear(); count.clear();
+            for (; s < m.surfaces.size(); ++s) {
+                const GDK_Legacy_Surface& surf = m.surfaces[s];
+                if ((surf.texture ? surf.texture : activeID) != tid) break;
+                if (surf.firstVert + surf.numVerts > verts.size()) continue;
+                first.push_back((GLint)surf.firstVert);
+                count.push_back((GLsizei)surf.numVerts);
+            }
+            Bind(tid);
+            if (!first.empty()) glMultiDrawArrays(GL_TRIANGLES, first.data(), count.data(), (GLsizei)first.size());
+            Unbind(tid);
+        }
+    }
+
+    if (modern) {
+        glBindVertexArray(0);
+    } else {
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    }
+}
+
+// LOD for a legacy draw whose vertices stay inside 'b' (-1 = full detail)
+static int GDK_Internal_LegacyPickLOD(GDK_Legacy_Model& m, const GDK_Legacy_Bounds& b) {
+    if (m.lods.empty() || m.lods[0].frames.size() != m.frames.size()) return -1;
+    float errors[GDK_LOD_MAX];
+    int count = (int)std::min<size_t>(m.lods.size(), GDK_LOD_MAX);
+    for (int l = 0; l < count; ++l) errors[l] = m.lods[l].error;
+    return GDK_Internal_PickLOD(m.lodState, errors, count, b);
+}
+
+static const std::vector<GDK_Legacy_Vert>& GDK_Internal_LegacyLODFrame(const GDK_Legacy_Model& m, int f, int lod) {
+    return lod >= 0 ? m.lods[lod].frames[f] : m.frames[f];
+}
+
+// --- FRAME BLENDING ---
+// Legacy mode has no vertex shader to lerp keyframes, so the CPU does it: positions, normals and UVs
+// lerp lane-wise, then normals are renormalized. GDK_Legacy_Vert is 8 floats, so one vertex is one AVX
+// register (Or two SSE ones); blocks are transposed to SoA for the normalize. Same per-lane ops as the
+// scalar tail, so all paths agree (Bit for bit unless the compiler fuses the scalar one into FMAs).
+static void GDK_Internal_BlendScalar(const GDK_Legacy_Vert* a, const GDK_Legacy_Vert* b, float t,
+                                     GDK_Legacy_Vert* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        const float* pa = &a[i].x;
+        const float* pb = &b[i].x;
+        float* po = &out[i].x;
+        for (int k = 0; k < 8; ++k) po[k] = pa[k] + (pb[k] - pa[k]) * t;
+        float len2 = po[3] * po[3] + po[4] * po[4] + po[5] * po[5];
+        float inv = 1.0f / std::sqrt(std::max(len2, 1e-20f));
+        po[3] *= inv; po[4] *= inv; po[5] *= inv;
+    }
+}
+
+#ifdef GDK_SIMD_AVX2
+static inline void GDK_Internal_Transpose8(__m256* r) {
+    __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44), s1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44), s3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44), s5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44), s7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+    r[0] = _mm256_permute2f128_ps(s0, s4, 0x20); r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r[1] = _mm256_permute2f128_ps(s1, s5, 0x20); r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r[2] = _mm256_permute2f128_ps(s2, s6, 0x20); r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r[3] = _mm256_permute2f128_ps(s3, s7, 0x20); r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+#endif
+
+static void GDK_Internal_BlendFrames(const GDK_Legacy_Vert* a, const GDK_Legacy_Vert* b, float t,
+                                     GDK_Legacy_Vert* out, size_t n) {
+    size_t i = 0;
+#if defined(GDK_SIMD_AVX2)
+    const __m256 vt = _mm256_set1_ps(t), tiny = _mm256_set1_ps(1e-20f), one = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= n; i += 8) {
+        __m256 r[8];
+        for (int k = 0; k < 8; ++k) {
+            __m256 va = _mm256_loadu_ps(&a[i + k].x);
+            r[k] = _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&b[i + k].x), va), vt));
+        }
+        GDK_Internal_Transpose8(r); // r[3..5] = nx, ny, nz of 8 vertices
+        __m256 len2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r[3], r[3]), _mm256_mul_ps(r[4], r[4])), _mm256_mul_ps(r[5], r[5]));
+        __m256 inv = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_max_ps(len2, tiny)));
+        r[3] = _mm256_mul_ps(r[3], inv); r[4] = _mm256_mul_ps(r[4], inv); r[5] = _mm256_mul_ps(r[5], inv);
+        GDK_Internal_Transpose8(r);
+        for (int k = 0; k < 8; ++k) _mm256_storeu_ps(&out[i + k].x, r[k]);
+    }
+#elif defined(GDK_SIMD_SSE2)
+    const __m128 vt = _mm_set1_ps(t), tiny = _mm_set1_ps(1e-20f), one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= n; i += 4) {
+        __m128 lo[4], hi[4]; // (x, y, z, nx) and (ny, nz, u, v)
+        for (int k = 0; k < 4; ++k) {
+            const float* pa = &a[i + k].x;
+            const float* pb = &b[i + k].x;
+            __m128 al = _mm_loadu_ps(pa), ah = _mm_loadu_ps(pa + 4);
+            lo[k] = _mm_add_ps(al, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(pb), al), vt));
+            hi[k] = _mm_add_ps(ah, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(pb + 4), ah), vt));
+        }
+        _MM_TRANSPOSE4_PS(lo[0], lo[1], lo[2], lo[3]); // lo[3] = nx
+        _MM_TRANSPOSE4_PS(hi[0], hi[1], hi[2], hi[3]); // hi[0] = ny, hi[1] = nz
+        __m128 len2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lo[3], lo[3]), _mm_mul_ps(hi[0], hi[0])), _mm_mul_ps(hi[1], hi[1]));
+        __m128 inv = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(len2, tiny)));
+        lo[3] = _mm_mul_ps(lo[3], inv); hi[0] = _mm_mul_ps(hi[0], inv); hi[1] = _mm_mul_ps(hi[1], inv);
+        _MM_TRANSPOSE4_PS(lo[0], lo[1], lo[2], lo[3]);
+        _MM_TRANSPOSE4_PS(hi[0], hi[1], hi[2], hi[3]);
+        for (int k = 0; k < 4; ++k) {
+            _mm_storeu_ps(&out[i + k].x, lo[k]);
+            _mm_storeu_ps(&out[i + k].x + 4, hi[k]);
+        }
+    }
+#endif
+    GDK_Internal_BlendScalar(a + i, b + i, t, out + i, n - i);
+}
+
+// Queued blended draws: blended across the job pool in one pass, then submitted in queue order
+struct GDK_Internal_BlendInstance {
+    int mIdx, texOverride;
+    int frameA, frameB;
+    float lerp;
+    int lod;
+    glm::mat4 model;
+};
+
+#define GDK_BLEND_PARALLEL_MIN 4 // Fewer queued instances than this blend on the calling thread
+
+static std::vector<GDK_Internal_BlendInstance> g_BlendQueue;
+static std::vector<std::vector<GDK_Legacy_Vert>> g_BlendScratch; // Per queued instance, kept between frames
+
+// Blends (Or copies, for lerp 0 / same frame) the instance's vertices into 'out'
+static void GDK_Internal_BlendInstanceVerts(const GDK_Legacy_Model& m, int a, int b, float lerp, int lod, std::vector<GDK_Legacy_Vert>& out) {
+    const std::vector<GDK_Legacy_Vert>& fa = GDK_Internal_LegacyLODFrame(m, a, lod);
+    const std::vector<GDK_Legacy_Vert>& fb = GDK_Internal_LegacyLODFrame(m, b, lod);
+    size_t n = std::min(fa.size(), fb.size());
+    out.resize(n);
+    if (n) GDK_Internal_BlendFrames(fa.data(), fb.data(), lerp, out.data(), n);
+}
+
+// Blended vertices stay inside the union of both keyframe boxes; also picks the LOD for it
+static bool GDK_Internal_CullBlend(GDK_Legacy_Model& m, int frameA, int frameB, int& lod) {
+    lod = -1;
+    if (frameA >= (int)m.frameBounds.size() || frameB >= (int)m.frameBounds.size()) return false;
+    const GDK_Legacy_Bounds& a = m.frameBounds[frameA];
+    const GDK_Legacy_Bounds& b = m.frameBounds[frameB];
+    if (g_ModelCulling && GDK_Internal_CullBox(glm::min(a.min, b.min), glm::max(a.max, b.max))) return true;
+    const GDK_Legacy_Bounds& bigger = (a.radius >= b.radius) ? a : b;
+    GDK_Legacy_Bounds u = { glm::min(a.min, b.min), glm::max(a.max, b.max), bigger.center,
+                            bigger.radius + glm::length(a.center - b.center) };
+    lod = GDK_Internal_LegacyPickLOD(m, u);
+    return false;
+}
+
+// Validates the model and wraps both frames; lerp is clamped to [0, 1]
+static bool GDK_Internal_BlendResolve(int mIdx, int& frameA, int& frameB, float& lerp, GDK_Legacy_Model*& out) {
+    out = GDK_Internal_GetLegacyModel(mIdx);
+    if (!out) return false;
+    frameA = GDK_Internal_LegacyFrame(*out, frameA);
+    frameB = GDK_Internal_LegacyFrame(*out, frameB);
+    lerp = std::min(1.0f, std::max(0.0f, lerp));
+    if (lerp >= 1.0f) { frameA = frameB; lerp = 0.0f; }
+    return true;
+}
+
+// Vertices submitted per draw (MD2 strips/fans vs the triangle list - see the [MD2] load line)
+GDK_API int GDK_Model_GetDrawVerts(int mIdx) {
+    GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(mIdx);
+    return m ? (int)m->frames[0].size() : 0;
+}
+
+// --- 3. THE UNIVERSAL DRAW ---
+GDK_API void GDK_Model_Draw(int mIdx, int texOverride, int frameOrMesh) {
+    // 1. Master Index Safety
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return;
+    
+    GDK_Model_Master& master = gdk_models[mIdx];
+
+    switch (master.TypeID) {
+        case MDL: 
+        case MD2: 
+        case MD3: {
+            GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(mIdx);
+            if (!m) return;
+            int f = GDK_Internal_LegacyFrame(*m, frameOrMesh);
+            int lod = -1;
+            if (f < (int)m->frameBounds.size()) {
+                if (g_ModelCulling && GDK_Internal_CullBox(m->frameBounds[f].min, m->frameBounds[f].max)) return;
+                lod = GDK_Internal_LegacyPickLOD(*m, m->frameBounds[f]);
+            }
+            GDK_Internal_DrawLegacyModel(*m, texOverride, GDK_Internal_LegacyLODFrame(*m, f, lod), f, lod);
+        } break;
+
+        case STL: 
+        case REVOLT: {
+            GDK_Legacy_Bounds b;
+            bool hasBounds = GDK_Internal_ModelBounds(mIdx, 0, b);
+            if (g_ModelCulling && hasBounds && GDK_Internal_CullBox(b.min, b.max)) return;
+            // Direct call to the simplified STL / PRM renderers
+            if (master.TypeID == STL) {
+                int lod = -1;
+                if (hasBounds) { // Slot already validated by GDK_Internal_ModelBounds
+                    GDK_STL_Model& m = g_STLStore[master.InternalIndex];
+                    lod = GDK_Internal_PickLOD(m.lodState, m.lodError.data(), (int)m.lods.size(), b);
+                }
+                GDK_Internal_STL_Draw(master.InternalIndex, lod);
+            }
+            else PRM::PRM_Draw(master.InternalIndex);
+        } break;
+
+        default:
+            // Placeholder for OBJ/other future types
+            break;
+    }
+}
+
+
+// Legacy models between two keyframes (lerp 0 = frameA, 1 = frameB), blended on the CPU right now
+GDK_API void GDK_Model_DrawBlend(int mIdx, int texOverride, int frameA, int frameB, float lerp) {
+    GDK_Legacy_Model* m;
+    if (!GDK_Internal_BlendResolve(mIdx, frameA, frameB, lerp, m)) return;
+    int lod;
+    if (GDK_Internal_CullBlend(*m, frameA, frameB, lod)) return;
+    if (frameA == frameB || lerp <= 0.0f) {
+        GDK_Internal_DrawLegacyModel(*m, texOverride, GDK_Internal_LegacyLODFrame(*m, frameA, lod), frameA, lod);
+        return;
+    }
+
+    if (g_BlendScratch.empty()) g_BlendScratch.resize(1);
+    GDK_Internal_BlendInstanceVerts(*m, frameA, frameB, lerp, lod, g_BlendScratch[0]);
+    if (!g_BlendScratch[0].empty()) GDK_Internal_DrawLegacyModel(*m, texOverride, g_BlendScratch[0], -1, lod);
+}
+
+// Same as GDK_Model_DrawBlend, deferred to GDK_Model_FlushBlends with the current model matrix captured.
+// Queue every visible actor, then flush once: the blends run across the job pool.
+GDK_API void GDK_Model_QueueBlend(int mIdx, int texOverride, int frameA, int frameB, float lerp) {
+    GDK_Legacy_Model* m;
+    if (!GDK_Internal_BlendResolve(mIdx, frameA, frameB, lerp, m)) return;
+    int lod;
+    if (GDK_Internal_CullBlend(*m, frameA, frameB, lod)) return; // Off-screen actors are never blended
+    GDK_Internal_BlendInstance inst;
+    inst.mIdx = mIdx; inst.texOverride = texOverride;
+    inst.frameA = frameA; inst.frameB = frameB; inst.lerp = lerp;
+    inst.lod = lod;
+    glm::mat4* cur = GDK::Internal::g_ModelStack.current;
+    inst.model = cur ? *cur : glm::mat4(1.0f);
+    g_BlendQueue.push_back(inst);
+}
+
+GDK_API void GDK_Model_FlushBlends() {
+    if (g_BlendQueue.empty()) return;
+    int count = (int)g_BlendQueue.size();
+    if (g_BlendScratch.size() < (size_t)count) g_BlendScratch.resize(count);
+
+    auto Blend = [](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            const GDK_Internal_BlendInstance& inst = g_BlendQueue[i];
+            if (inst.frameA == inst.frameB || inst.lerp <= 0.0f) continue; // Drawn straight from the keyframe
+            const GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(inst.mIdx); // Freed since it was queued?
+            if (m && inst.lod < (int)m->lods.size()) GDK_Internal_BlendInstanceVerts(*m, inst.frameA, inst.frameB, inst.lerp, inst.lod, g_BlendScratch[i]);
+        }
+    };
+    if (count >= GDK_BLEND_PARALLEL_MIN) GDK::Jobs::ParallelFor(count, 1, Blend);
+    else Blend(0, count);
+
+    // Submission stays on the GL thread, in queue order
+    GDK::Internal::MatrixStack& stack = GDK::Internal::g_ModelStack;
+    for (int i = 0; i < count; ++i) {
+        const GDK_Internal_BlendInstance& inst = g_BlendQueue[i];
+        GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(inst.mIdx);
+        if (!m || inst.lod >= (int)m->lods.size()) continue;
+        if (stack.current) {
+            stack.Push();
+            *stack.current = inst.model;
+            if (GDK::mode == GDK_MODE_LEGACY) glLoadMatrixf(glm::value_ptr(*stack.current));
+        }
+        if (inst.frameA == inst.frameB || inst.lerp <= 0.0f)
+            GDK_Internal_DrawLegacyModel(*m, inst.texOverride, GDK_Internal_LegacyLODFrame(*m, inst.frameA, inst.lod), inst.frameA, inst.lod);
+        else if (!g_BlendScratch[i].empty()) GDK_Internal_DrawLegacyModel(*m, inst.texOverride, g_BlendScratch[i], -1, inst.lod);
+        if (stack.current) stack.Pop();
+    }
+    if (stack.current && GDK::mode == GDK_MODE_LEGACY) glLoadMatrixf(glm::value_ptr(*stack.current));
+    g_BlendQueue.clear();
+}
+
+
+// Screen-space error budget for automatic LODs, in pixels (Default 1). <= 0 always draws full detail.
+// Hysteresis remembers each instance's last level. Without GDK_Model_SetLODInstance instances are told apart
+// by draw order, so culled or reordered draws trade histories and may pop; tag them if the order moves.
+GDK_API void GDK_Model_SetLODError(float pixels) { g_LODPixelError = pixels; }
+
+// Tags the following draws as instance 'id' (Any stable number, e.g. the entity index) for LOD hysteresis.
+// Stays set until changed, like a colour; -1 goes back to draw order.
+GDK_API void GDK_Model_SetLODInstance(int id) { g_LODInstance = id; }
+
+static const GDK_STL_Model* GDK_Internal_GetSTLModel(int mIdx) {
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size() || gdk_models[mIdx].TypeID != STL) return nullptr;
+    int slot = gdk_models[mIdx].InternalIndex;
+    if (slot < 0 || (size_t)slot >= g_STLStore.size() || !g_STLStore[slot].InUse) return nullptr;
+    return &g_STLStore[slot];
+}
+
+// Simplified levels generated for a model (0 = none; PRM cars have none)
+GDK_API int GDK_Model_GetLODCount(int mIdx) {
+    if (const GDK_STL_Model* stl = GDK_Internal_GetSTLModel(mIdx)) return (int)stl->lods.size();
+    GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(mIdx);
+    return m ? (int)m->lods.size() : 0;
+}
+
+// Triangles drawn at a level (-1 = full detail), 0 for a bad index/level
+GDK_API int GDK_Model_GetLODTris(int mIdx, int lod) {
+    if (const GDK_STL_Model* stl = GDK_Internal_GetSTLModel(mIdx)) {
+        if (lod < 0) return (int)(stl->indices.size() / 3);
+        return (size_t)lod < stl->lods.size() ? (int)(stl->lods[lod].size() / 3) : 0;
+    }
+    GDK_Legacy_Model* m = GDK_Internal_GetLegacyModel(mIdx);
+    if (!m) return 0;
+    if (lod < 0) {
+        std::vector<uint32_t> tris, triSurface;
+        GDK_Internal_LegacyTriangles(*m, tris, triSurface);
+        return (int)(tris.size() / 3);
+    }
+    return (size_t)lod < m->lods.size() ? (int)(m->lods[lod].indices.size() / 3) : 0;
+}
+
+// Model-space bounds at a frame (Frame ignored for STL/PRM). Returns 0 for a bad index.
+GDK_API int GDK_Model_GetBounds(int mIdx, int frame, GDK_ModelBounds* out) {
+    GDK_Legacy_Bounds b;
+    if (!out || !GDK_Internal_ModelBounds(mIdx, frame, b)) return 0;
+    out->min[0] = b.min.x; out->min[1] = b.min.y; out->min[2] = b.min.z;
+    out->max[0] = b.max.x; out->max[1] = b.max.y; out->max[2] = b.max.z;
+    out->center[0] = b.center.x; out->center[1] = b.center.y; out->center[2] = b.center.z;
+    out->radius = b.radius;
+    return 1;
+}
+
+// Frustum test inside GDK_Model_Draw / DrawBlend / QueueBlend (Default off)
+GDK_API void GDK_Model_SetCulling(int enable) {
+    g_ModelCulling = (enable != 0);
+    if (g_ModelCulling) GDK::Internal::AddFrameHook(GDK_Internal_ModelCullFrame);
+}
+
+// Tested/culled draw counts for the last completed frame
+GDK_API void GDK_Model_GetCullStats(GDK_ModelCullStats* out) {
+    if (out) *out = g_ModelCullLast;
+}
+
+GDK_API void GDK_Model_Free(int mIdx) {
+    if (mIdx < 0 || (size_t)mIdx >= gdk_models.size()) return;
+    
+    GDK_Model_Master& master = gdk_models[mIdx];
+    
+    // Only legacy models (MDL, MD2, MD3) currently use g_ModelStore
+    if (master.TypeID == MDL || master.TypeID == MD2 || master.TypeID == MD3) {
+        if (master.InternalIndex >= 0 && (size_t)master.InternalIndex < g_ModelStore.size()) {
+            g_ModelStore[master.InternalIndex].Free();
+        }
+    } else if (master.TypeID == STL) {
+        if (master.InternalIndex >= 0 && (size_t)master.InternalIndex < g_STLStore.size()) {
+            g_STLStore[master.InternalIndex].Free();
+        }
+    } else if (master.TypeID == REVOLT) {
+        PRM::FreeSlot(master.InternalIndex); // Drops the shared mesh and TPAGE references
+    }
+    
+    // Mark the Master Record as empty so it can be reused too
+    master.TypeID = TYPE_NONE;
+    master.InternalIndex = -1;
+}
+
+
+GDK_END_DECLS
+#endif
@@ -0,0 +1,407 @@
+#ifndef GDK_MODEL_LOD_H
+#define GDK_MODEL_LOD_H
+
+// --- AUTOMATIC LODS (Quadric error metric) ---
+// Half-edge collapses only: a simplified level keeps a subset of the original vertices, so one index
+// buffer serves every animation frame and the frames are just gathers of the full ones. Quadrics are
+// summed over a few sample frames so a collapse that looks fine in the idle pose but tears the run
+// cycle is priced accordingly. Open borders - which includes every UV seam and MD3 surface edge once
+// vertices are welded by (position, UV) - are locked, so seams never crack.
+//
+// GDK_Model_Draw picks the coarsest level whose error projects under g_LODPixelError pixels.
+
+#define GDK_LOD_SAMPLE_FRAMES 4     // Frames whose quadrics price each collapse
+#define GDK_LOD_MIN_TRIS      64    // Smaller meshes are not worth a level
+#define GDK_LOD_HYSTERESIS    0.7f  // Go coarser only once the error is this far under the threshold
+#define GDK_LOD_FORGET_FRAMES 120   // Instance history unused this long is dropped
+
+static float g_LODPixelError = 1.0f; // GDK_Model_SetLODError (<= 0 = always full detail)
+static int g_LODInstance = -1;       // GDK_Model_SetLODInstance (-1 = key by draw order)
+static const float g_LODRatios[GDK_LOD_MAX] = { 0.5f, 0.25f, 0.125f };
+
+struct GDK_Internal_Quadric {
+    double a[10] = {}; // xx xy xz xw yy yz yw zz zw ww
+
+    void AddPlane(double x, double y, double z, double w) {
+        a[0] += x * x; a[1] += x * y; a[2] += x * z; a[3] += x * w;
+        a[4] += y * y; a[5] += y * z; a[6] += y * w;
+        a[7] += z * z; a[8] += z * w; a[9] += w * w;
+    }
+    void Add(const GDK_Internal_Quadric& q) { for (int i = 0; i < 10; ++i) a[i] += q.a[i]; }
+    double Eval(const glm::vec3& p) const {
+        double x = p.x, y = p.y, z = p.z;
+        return a[0] * x * x + 2 * a[1] * x * y + 2 * a[2] * x * z + 2 * a[3] * x +
+               a[4] * y * y + 2 * a[5] * y * z + 2 * a[6] * y +
+               a[7] * z * z + 2 * a[8] * z + a[9];
+    }
+};
+
+// pos[s * numVerts + v] for each sample frame s. Snapshots the surviving triangles each time the count
+// drops under ratios[k] * original, with the error (sqrt of the worst accepted cost per sample) so far.
+static void GDK_Internal_SimplifyQEM(const std::vector<glm::vec3>& pos, int numVerts, int numSamples,
+                                     const std::vector<uint32_t>& triIn, const float* ratios, int levels,
+                                     std::vector<std::vector<uint32_t>>& outTris, std::vector<float>& outError) {
+    outTris.clear(); outError.clear();
+    std::vector<uint32_t> tris = triIn;
+    int numTris = (int)tris.size() / 3;
+    if (numTris < GDK_LOD_MIN_TRIS || numSamples <= 0) return;
+
+    // Plane quadrics per vertex per sample
+    std::vector<GDK_Internal_Quadric> Q((size_t)numVerts * numSamples);
+    for (int t = 0; t < numTris; ++t) {
+        for (int s = 0; s < numSamples; ++s) {
+            const glm::vec3* P = &pos[(size_t)s * numVerts];
+            glm::vec3 p0 = P[tris[t * 3]], p1 = P[tris[t * 3 + 1]], p2 = P[tris[t * 3 + 2]];
+            glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+            float len = glm::length(n);
+            if (len < 1e-12f) continue;
+            n /= len;
+            for (int k = 0; k < 3; ++k) Q[(size_t)s * numVerts + tris[t * 3 + k]].AddPlane(n.x, n.y, n.z, -glm::dot(n, p0));
+        }
+    }
+
+    // Vertex -> triangles, and lock everything on an open or non-manifold edge
+    std::vector<std::vector<uint32_t>> vtris(numVerts);
+    std::unordered_map<uint64_t, int> edgeUse;
+    for (int t = 0; t < numTris; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            uint32_t a = tris[t * 3 + k], b = tris[t * 3 + (k + 1) % 3];
+            vtris[a].push_back(t);
+            edgeUse[((uint64_t)std::min(a, b) << 32) | std::max(a, b)]++;
+        }
+    }
+    std::vector<uint8_t> locked(numVerts, 0);
+    for (const auto& e : edgeUse) {
+        if (e.second != 2) { locked[e.first >> 32] = 1; locked[e.first & 0xFFFFFFFFu] = 1; }
+    }
+
+    auto Cost = [&](uint32_t u, uint32_t v) {
+        double c = 0.0;
+        for (int s = 0; s < numSamples; ++s) {
+            const glm::vec3& target = pos[(size_t)s * numVerts + v];
+            c += Q[(size_t)s * numVerts + u].Eval(target) + Q[(size_t)s * numVerts + v].Eval(target);
+        }
+        return std::max(0.0, c);
+    };
+
+    struct Candidate { double cost; uint32_t u, v; };
+    auto Cmp = [](const Candidate& a, const Candidate& b) { return a.cost > b.cost; };
+    std::priority_queue<Candidate, std::vector<Candidate>, decltype(Cmp)> heap(Cmp);
+    auto PushAround = [&](uint32_t v, const std::vector<uint8_t>& dead) {
+        for (uint32_t t : vtris[v]) {
+            if (dead[t]) continue;
+            for (int k = 0; k < 3; ++k) {
+                uint32_t w = tris[t * 3 + k];
+                if (w == v) continue;
+                if (!locked[v]) heap.push({ Cost(v, w), v, w });
+                if (!locked[w]) heap.push({ Cost(w, v), w, v });
+            }
+        }
+    };
+
+    std::vector<uint8_t> dead(numTris, 0), gone(numVerts, 0);
+    for (int v = 0; v < numVerts; ++v) {
+        for (uint32_t t : vtris[v]) {
+            for (int k = 0; k < 3; ++k) {
+                uint32_t w = tris[t * 3 + k];
+                if (w != (uint32_t)v && !locked[v]) heap.push({ Cost(v, w), (uint32_t)v, w });
+            }
+        }
+    }
+
+    int alive = numTris, level = 0;
+    double worst = 0.0;
+    auto Snapshot = [&]() {
+        std::vector<uint32_t> out;
+        out.reserve((size_t)alive * 3);
+        for (int t = 0; t < numTris; ++t) {
+            if (!dead[t]) out.insert(out.end(), tris.begin() + t * 3, tris.begin() + t * 3 + 3);
+        }
+        outTris.push_back(std::move(out));
+        outError.push_back((float)std::sqrt(worst / numSamples));
+    };
+
+    while (level < levels && !heap.empty()) {
+        Candidate c = heap.top();
+        heap.pop();
+        if (gone[c.u] || gone[c.v]) continue;
+
+        // Costs only grow as quadrics merge - re-queue stale entries instead of tracking versions
+        double cost = Cost(c.u, c.v);
+        if (cost > c.cost * 1.0001 + 1e-12) { heap.push({ cost, c.u, c.v }); continue; }
+
+        // Edge must still exist, and no surviving triangle may fold over in any sample frame
+        bool edge = false, ok = true;
+        for (uint32_t t : vtris[c.u]) {
+            if (dead[t]) continue;
+            const uint32_t* tri = &tris[t * 3];
+            if (tri[0] == c.v || tri[1] == c.v || tri[2] == c.v) { edge = true; continue; }
+            for (int s = 0; s < numSamples && ok; ++s) {
+                const glm::vec3* P = &pos[(size_t)s * numVerts];
+                glm::vec3 before = glm::cross(P[tri[1]] - P[tri[0]], P[tri[2]] - P[tri[0]]);
+                glm::vec3 q[3] = { P[tri[0]], P[tri[1]], P[tri[2]] };
+                for (int k = 0; k < 3; ++k) if (tri[k] == c.u) q[k] = P[c.v];
+                glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+                float lb = glm::length(before), la = glm::length(after);
+                if (la < 1e-12f || (lb > 1e-12f && glm::dot(before, after) < 0.25f * lb * la)) ok = false;
+            }
+            if (!ok) break;
+        }
+        if (!edge || !ok) continue;
+
+        // Collapse u -> v
+        for (uint32_t t : vtris[c.u]) {
+            if (dead[t]) continue;
+            uint32_t* tri = &tris[t * 3];
+            if (tri[0] == c.v || tri[1] == c.v || tri[2] == c.v) { dead[t] = 1; alive--; continue; }
+            for (int k = 0; k < 3; ++k) if (tri[k] == c.u) tri[k] = c.v;
+            vtris[c.v].push_back(t);
+        }
+        vtris[c.u].clear();
+        gone[c.u] = 1;
+        for (int s = 0; s < numSamples; ++s) Q[(size_t)s * numVerts + c.v].Add(Q[(size_t)s * numVerts + c.u]);
+        worst = std::max(worst, cost);
+
+        // Drop dead references so the neighbourhood scans stay short
+        auto& vt = vtris[c.v];
+        vt.erase(std::remove_if(vt.begin(), vt.end(), [&](uint32_t t) { return dead[t] != 0; }), vt.end());
+        PushAround(c.v, dead);
+
+        while (level < levels && alive <= (int)(ratios[level] * numTris)) { Snapshot(); level++; }
+    }
+}
+
+// Triangle list of a legacy model as original vertex indices (Decodes MD2 strips/fans), plus the
+// m.surfaces entry each triangle belongs to.
+static void GDK_Internal_LegacyTriangles(const GDK_Legacy_Model& m, std::vector<uint32_t>& tris, std::vector<uint32_t>& triSurface) {
+    tris.clear(); triSurface.clear();
+    uint32_t n = m.frames.empty() ? 0 : (uint32_t)m.frames[0].size();
+    if (!m.stripFirst.empty() || !m.fanFirst.empty()) {
+        for (size_t i = 0; i < m.stripFirst.size(); ++i) {
+            uint32_t f = (uint32_t)m.stripFirst[i];
+            for (GLsizei k = 2; k < m.stripCount[i]; ++k) {
+                uint32_t a = f + k - 2, b = f + k - 1, c = f + k;
+                if (k & 1) std::swap(a, b); // Strips alternate winding
+                tris.insert(tris.end(), { a, b, c });
+            }
+        }
+        for (size_t i = 0; i < m.fanFirst.size(); ++i) {
+            uint32_t f = (uint32_t)m.fanFirst[i];
+            for (GLsizei k = 2; k < m.fanCount[i]; ++k) tris.insert(tris.end(), { f, f + k - 1, f + k });
+        }
+        triSurface.assign(tris.size() / 3, 0);
+    } else if (!m.surfaces.empty()) {
+        for (uint32_t s = 0; s < (uint32_t)m.surfaces.size(); ++s) {
+            const GDK_Legacy_Surface& surf = m.surfaces[s];
+            for (uint32_t v = surf.firstVert; v + 2 < surf.firstVert + surf.numVerts && v + 2 < n; v += 3) {
+                tris.insert(tris.end(), { v, v + 1, v + 2 });
+                triSurface.push_back(s);
+            }
+        }
+    } else {
+        for (uint32_t v = 0; v + 2 < n; v += 3) tris.insert(tris.end(), { v, v + 1, v + 2 });
+        triSurface.assign(tris.size() / 3, 0);
+    }
+}
+
+// Welds by (surface, UV, position in every sample frame) and fills m.lods
+static void GDK_Internal_BuildLegacyLODs(GDK_Legacy_Model& m) {
+    for (auto& l : m.lods) if (l.ebo) glDeleteBuffers(1, &l.ebo);
+    m.lods.clear();
+    for (auto& s : m.surfaces) { memset(s.lodFirst, 0, sizeof(s.lodFirst)); memset(s.lodCount, 0, sizeof(s.lodCount)); }
+    if (m.frames.empty()) return;
+
+    std::vector<uint32_t> tris, triSurface;
+    GDK_Internal_LegacyTriangles(m, tris, triSurface);
+    if ((int)tris.size() / 3 < GDK_LOD_MIN_TRIS) return;
+
+    int numSamples = std::min<int>(GDK_LOD_SAMPLE_FRAMES, (int)m.frames.size());
+    std::vector<int> sampleFrame(numSamples);
+    for (int s = 0; s < numSamples; ++s) sampleFrame[s] = (int)((size_t)s * m.frames.size() / numSamples);
+
+    // Surface of each original vertex
+    uint32_t n = (uint32_t)m.frames[0].size();
+    std::vector<uint32_t> vertSurface(n, 0);
+    for (size_t t = 0; t < triSurface.size(); ++t)
+        for (int k = 0; k < 3; ++k) vertSurface[tris[t * 3 + k]] = triSurface[t];
+
+    // Weld: sort by key, equal keys share an id
+    const int K = 3 + numSamples * 3;
+    std::vector<float> keys((size_t)n * K);
+    for (uint32_t v = 0; v < n; ++v) {
+        float* k = &keys[(size_t)v * K];
+        const GDK_Legacy_Vert& v0 = m.frames[0][v];
+        k[0] = (float)vertSurface[v]; k[1] = v0.u; k[2] = v0.v;
+        for (int s = 0; s < numSamples; ++s) {
+            const GDK_Legacy_Vert& p = m.frames[sampleFrame[s]][v];
+            k[3 + s * 3] = p.x; k[4 + s * 3] = p.y; k[5 + s * 3] = p.z;
+        }
+    }
+    std::vector<uint32_t> order(n);
+    for (uint32_t v = 0; v < n; ++v) order[v] = v;
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return memcmp(&keys[(size_t)a * K], &keys[(size_t)b * K], K * sizeof(float)) < 0;
+    });
+    std::vector<uint32_t> weld(n), source;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t v = order[i];
+        if (i == 0 || memcmp(&keys[(size_t)v * K], &keys[(size_t)order[i - 1] * K], K * sizeof(float)) != 0) source.push_back(v);
+        weld[v] = (uint32_t)source.size() - 1;
+    }
+
+    int numVerts = (int)source.size();
+    std::vector<glm::vec3> pos((size_t)numVerts * numSamples);
+    for (int s = 0; s < numSamples; ++s) {
+        for (int v = 0; v < numVerts; ++v) {
+            const GDK_Legacy_Vert& p = m.frames[sampleFrame[s]][source[v]];
+            pos[(size_t)s * numVerts + v] = glm::vec3(p.x, p.y, p.z);
+        }
+    }
+    std::vector<uint32_t> welded(tris.size());
+    for (size_t i = 0; i < tris.size(); ++i) welded[i] = weld[tris[i]];
+
+    std::vector<std::vector<uint32_t>> levels;
+    std::vector<float> errors;
+    GDK_Internal_SimplifyQEM(pos, numVerts, numSamples, welded, g_LODRatios, GDK_LOD_MAX, levels, errors);
+
+    size_t prevTris = tris.size() / 3;
+    for (size_t l = 0; l < levels.size(); ++l) {
+        const std::vector<uint32_t>& lt = levels[l];
+        if (lt.empty() || lt.size() / 3 > prevTris * 85 / 100) break; // Collapses ran dry - no real saving
+        prevTris = lt.size() / 3;
+
+        GDK_Legacy_LOD lod;
+        lod.error = errors[l];
+        std::vector<int> remap(numVerts, -1);
+        size_t numSurf = std::max<size_t>(1, m.surfaces.size());
+        std::vector<std::vector<uint32_t>> bySurface(numSurf);
+        for (size_t t = 0; t < lt.size() / 3; ++t) {
+            uint32_t s = std::min<uint32_t>(vertSurface[source[lt[t * 3]]], (uint32_t)numSurf - 1);
+            for (int k = 0; k < 3; ++k) {
+                uint32_t w = lt[t * 3 + k];
+                if (remap[w] < 0) { remap[w] = (int)lod.source.size(); lod.source.push_back(source[w]); }
+                bySurface[s].push_back((uint32_t)remap[w]);
+            }
+        }
+        for (size_t s = 0; s < numSurf; ++s) {
+            if (s < m.surfaces.size()) {
+                m.surfaces[s].lodFirst[m.lods.size()] = (uint32_t)lod.indices.size();
+                m.surfaces[s].lodCount[m.lods.size()] = (uint32_t)bySurface[s].size();
+            }
+            lod.indices.insert(lod.indices.end(), bySurface[s].begin(), bySurface[s].end());
+        }
+        m.lods.push_back(std::move(lod));
+    }
+}
+
+// LOD frames are gathers of the full frames (Re-run after anything rewrites m.frames, e.g. the atlas)
+static void GDK_Internal_GatherLODFrames(GDK_Legacy_Model& m) {
+    for (auto& lod : m.lods) {
+        lod.frames.resize(m.frames.size());
+        for (size_t f = 0; f < m.frames.size(); ++f) {
+            lod.frames[f].resize(lod.source.size());
+            for (size_t i = 0; i < lod.source.size(); ++i) lod.frames[f][i] = m.frames[f][lod.source[i]];
+        }
+    }
+}
+
+// STL: simplified over position-only topology (Crease vertices are split by normal, which would otherwise
+// read as open borders), then each corner goes back to the split copy whose normal best fits the face.
+static void GDK_Internal_BuildSTLLODs(GDK_STL_Model& m) {
+    m.lods.clear(); m.lodError.clear();
+    size_t n = m.indices.size() / 3;
+    if (n < GDK_LOD_MIN_TRIS) return;
+    if (n > GDK_STL_LOD_MAX_TRIS) {
+        printf("[STL] %u tris - over GDK_STL_LOD_MAX_TRIS, no LODs\n", (uint32_t)n);
+        return;
+    }
+
+    std::vector<uint32_t> posOf, posFirst;
+    GDK_Internal_HashWeld<3>((uint32_t)m.vertices.size(), [&](uint32_t v, uint32_t* k) {
+        k[0] = GDK_Internal_WeldFloatKey(m.vertices[v].x);
+        k[1] = GDK_Internal_WeldFloatKey(m.vertices[v].y);
+        k[2] = GDK_Internal_WeldFloatKey(m.vertices[v].z);
+    }, posOf, posFirst);
+    std::vector<glm::vec3> pos(posFirst.size());
+    for (size_t i = 0; i < posFirst.size(); ++i) {
+        const GDK_Legacy_Vert& v = m.vertices[posFirst[i]];
+        pos[i] = glm::vec3(v.x, v.y, v.z);
+    }
+    std::vector<uint32_t> variantStart(pos.size() + 1, 0), variants(m.vertices.size());
+    for (uint32_t v = 0; v < (uint32_t)m.vertices.size(); ++v) variantStart[posOf[v] + 1]++;
+    for (size_t i = 0; i < pos.size(); ++i) variantStart[i + 1] += variantStart[i];
+    std::vector<uint32_t> fill(variantStart.begin(), variantStart.end() - 1);
+    for (uint32_t v = 0; v < (uint32_t)m.vertices.size(); ++v) variants[fill[posOf[v]]++] = v;
+
+    std::vector<uint32_t> tris(m.indices.size());
+    for (size_t i = 0; i < tris.size(); ++i) tris[i] = posOf[m.indices[i]];
+
+    std::vector<std::vector<uint32_t>> levels;
+    GDK_Internal_SimplifyQEM(pos, (int)pos.size(), 1, tris, g_LODRatios, GDK_LOD_MAX, levels, m.lodError);
+
+    size_t prevTris = n;
+    for (size_t l = 0; l < levels.size(); ++l) {
+        const std::vector<uint32_t>& lt = levels[l];
+        if (lt.empty() || lt.size() / 3 > prevTris * 85 / 100) break;
+        prevTris = lt.size() / 3;
+        std::vector<uint32_t> out(lt.size());
+        for (size_t t = 0; t < lt.size() / 3; ++t) {
+            glm::vec3 nrm = glm::cross(pos[lt[t * 3 + 1]] - pos[lt[t * 3]], pos[lt[t * 3 + 2]] - pos[lt[t * 3]]);
+            for (int k = 0; k < 3; ++k) {
+                uint32_t p = lt[t * 3 + k], best = variants[variantStart[p]];
+                float bestDot = -2.0f;
+                for (uint32_t a = variantStart[p]; a < variantStart[p + 1]; ++a) {
+                    const GDK_Legacy_Vert& v = m.vertices[variants[a]];
+                    float d = nrm.x * v.nx + nrm.y * v.ny + nrm.z * v.nz;
+                    if (d > bestDot) { bestDot = d; best = variants[a]; }
+                }
+                out[t * 3 + k] = best;
+            }
+        }
+        m.lods.push_back(std::move(out));
+    }
+    m.lodError.resize(m.lods.size());
+}
+
+// Level for one draw under the current modelview/projection: -1 = full detail, else index into the levels.
+// Moving to a coarser level needs the error GDK_LOD_HYSTERESIS under the threshold, so a model sitting
+// at the boundary does not pop back and forth.
+static int GDK_Internal_PickLOD(GDK_Internal_LODState& st, const float* errors, int count, const GDK_Legacy_Bounds& b) {
+    if (count <= 0 || g_LODPixelError <= 0.0f || !GDK::state) return -1;
+
+    int frame = GDK::state->frameCount;
+    if (st.frame != frame) {
+        st.frame = frame;
+        st.seq = 0;
+        if ((frame % GDK_LOD_FORGET_FRAMES) == 0) {
+            for (auto it = st.history.begin(); it != st.history.end(); ) {
+                if (frame - it->second.frame > GDK_LOD_FORGET_FRAMES) it = st.history.erase(it);
+                else ++it;
+            }
+        }
+    }
+    uint32_t key = (g_LODInstance >= 0) ? (uint32_t)g_LODInstance & 0x7FFFFFFFu : (0x80000000u | st.seq++);
+    GDK_Internal_LODHistory& h = st.history[key];
+    if (h.frame < frame - 1) h.lod = -1; // Not drawn last frame - nothing to be sticky about
+    h.frame = frame;
+
+    const glm::mat4& mv = GDK::state->view;
+    glm::vec4 c = mv * glm::vec4(b.center.x, b.center.y, b.center.z, 1.0f);
+    float scale = std::max(glm::length(glm::vec3(mv[0].x, mv[0].y, mv[0].z)),
+                  std::max(glm::length(glm::vec3(mv[1].x, mv[1].y, mv[1].z)), glm::length(glm::vec3(mv[2].x, mv[2].y, mv[2].z))));
+    float dist = -c.z - b.radius * scale;
+    int pick = -1;
+    if (dist > 0.0f) {
+        float pxPerUnit = GDK::state->projection[1][1] * GDK::state->resolution.y * 0.5f * scale / dist;
+        int prev = std::min<int>(h.lod, count - 1);
+        for (int l = count - 1; l >= 0; --l) {
+            float px = errors[l] * pxPerUnit;
+            float limit = (l > prev) ? g_LODPixelError * GDK_LOD_HYSTERESIS : g_LODPixelError;
+            if (px < limit) { pick = l; break; }
+        }
+    }
+    h.lod = (int8_t)pick;
+    return pick;
+}
+
+#endif // GDK_MODEL_LOD_H
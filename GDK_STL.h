@@ -1,93 +1,323 @@
-#ifndef GDK_STL_H
-#define GDK_STL_H
-
-struct GDK_STL_Model {
-    bool InUse = false;
-    uint32_t numTris = 0;
-    std::vector<GDK_Legacy_Vert> vertices; 
-
-    void Free() {
-        vertices.clear();
-        InUse = false;
-        numTris = 0;
-    }
-};
-
-static std::vector<GDK_STL_Model> g_STLStore; 
-
-// Quake 3/Binary STL structures must be byte-aligned for direct file reading
-#pragma pack(push, 1)
-struct STL_Triangle {
-    float normal[3];   // Facet Normal
-    float vertex1[3];  // Vertex 1
-    float vertex2[3];  // Vertex 2
-    float vertex3[3];  // Vertex 3
-    uint16_t attribute; // Attribute byte count (usually 0)
-};
-#pragma pack(pop)
-
-
-
-
-// 1. Slot Finder: Manages the internal g_STLStore array
-static int GDK_Internal_GetFreeSTLSlot() {
-    for (int i = 0; i < (int)g_STLStore.size(); ++i) {
-        if (!g_STLStore[i].InUse) return i;
-    }
-    g_STLStore.push_back(GDK_STL_Model());
-    return (int)g_STLStore.size() - 1;
-}
-
-// 2. Internal Draw: Pure Legacy 1.1 Geometry
-static void GDK_Internal_STL_Draw(int internalIdx) {
-    if (internalIdx < 0 || (size_t)internalIdx >= g_STLStore.size()) return;
-    GDK_STL_Model& m = g_STLStore[internalIdx];
-    if (!m.InUse || m.vertices.empty()) return;
-
-    glDisable(GL_TEXTURE_2D); 
-    
-    glBegin(GL_TRIANGLES);
-    for (const auto& v : m.vertices) {
-        glNormal3f(v.nx, v.ny, v.nz);
-        glVertex3f(v.x, v.y, v.z);
-    }
-    glEnd();
-}
-
-// 3. Binary Loader
-static bool GDK_Internal_LoadSTL(const char* mPath, GDK_STL_Model& model) {
-    std::ifstream file(mPath, std::ios::binary);
-    if (!file.is_open()) return false;
-
-    file.seekg(80, std::ios::beg); // Skip header
-
-    uint32_t numTris = 0;
-    file.read((char*)&numTris, 4);
-    if (numTris == 0) { file.close(); return false; }
-
-    model.numTris = numTris;
-    model.vertices.reserve(numTris * 3);
-
-    for (uint32_t i = 0; i < numTris; ++i) {
-        STL_Triangle tri;
-        file.read((char*)&tri, sizeof(STL_Triangle));
-
-        for (int v = 0; v < 3; ++v) {
-            GDK_Legacy_Vert gv;
-            float* p;
-            if (v == 0) p = (float*)&tri.vertex1;
-            else if (v == 1) p = (float*)&tri.vertex2;
-            else p = (float*)&tri.vertex3;
-
-            gv.x = p[0]; gv.y = p[1]; gv.z = p[2];
-            gv.nx = tri.normal[0]; gv.ny = tri.normal[1]; gv.nz = tri.normal[2];
-            gv.u = 0; gv.v = 0;
-            model.vertices.push_back(gv);
-        }
-    }
-
-    file.close();
-    return true;
-}
-
-#endif
+#ifndef GDK_STL_H
+#define GDK_STL_H
+
+// --- STL (Binary + ASCII) ---
+// The file is memory-mapped and welded straight into an indexed mesh: corners are hashed by position,
+// normals are smoothed across edges flatter than g_STLSmoothAngle (Sharper ones keep a crease), then
+// (position, normal) pairs are hashed again into the final vertices. A CAD export goes from 96 bytes of
+// unrolled GDK_Legacy_Vert per triangle to roughly 16 bytes of vertex plus 12 of index.
+
+#define GDK_STL_PARSE_CHUNK  (1 << 20) // Min bytes of ASCII per parse job
+#define GDK_STL_LOD_MAX_TRIS 1000000   // Bigger meshes skip LOD generation (Simplifying them stalls the load)
+
+static float g_STLSmoothAngle = 30.0f; // GDK_Model_SetSTLSmoothing (Degrees, <= 0 = facet normals)
+
+struct GDK_STL_Model {
+    bool InUse = false;
+    uint32_t numTris = 0;
+    std::vector<GDK_Legacy_Vert> vertices;          // Welded
+    std::vector<uint32_t> indices;                  // Triangle list into vertices
+    GDK_Legacy_Bounds bounds = {};
+    std::vector<std::vector<uint32_t>> lods;        // Simplified levels, also indexing vertices
+    std::vector<float> lodError;                    // Object-space error per level
+    GDK_Internal_LODState lodState;
+    uint32_t vao = 0, vbo = 0, ebo = 0;             // Modes 1 & 2: every level in one EBO
+    std::vector<uint32_t> lodFirst;                 // EBO offset (In indices) of each level
+    GDK_MeshletSet meshlets;                        // Full detail as clusters (Big meshes only)
+
+    void Free() {
+        if (ebo) glDeleteBuffers(1, &ebo);
+        if (vbo) glDeleteBuffers(1, &vbo);
+        if (vao) glDeleteVertexArrays(1, &vao);
+        vao = vbo = ebo = 0;
+        vertices.clear(); indices.clear();
+        bounds = GDK_Legacy_Bounds();
+        lods.clear(); lodError.clear(); lodFirst.clear();
+        lodState = GDK_Internal_LODState();
+        meshlets.Free();
+        InUse = false;
+        numTris = 0;
+    }
+};
+
+static std::vector<GDK_STL_Model> g_STLStore;
+
+// Quake 3/Binary STL structures must be byte-aligned for direct file reading
+#pragma pack(push, 1)
+struct STL_Triangle {
+    float normal[3];   // Facet Normal
+    float vertex1[3];  // Vertex 1
+    float vertex2[3];  // Vertex 2
+    float vertex3[3];  // Vertex 3
+    uint16_t attribute; // Attribute byte count (usually 0)
+};
+#pragma pack(pop)
+
+
+
+
+// 1. Slot Finder: Manages the internal g_STLStore array
+static int GDK_Internal_GetFreeSTLSlot() {
+    for (int i = 0; i < (int)g_STLStore.size(); ++i) {
+        if (!g_STLStore[i].InUse) return i;
+    }
+    g_STLStore.push_back(GDK_STL_Model());
+    return (int)g_STLStore.size() - 1;
+}
+
+// 2. Internal Draw: client arrays in Legacy mode, a static VAO otherwise. Full detail goes through the
+// cluster cull when the mesh has meshlets.
+static void GDK_Internal_STL_Draw(int internalIdx, int lod = -1) {
+    if (internalIdx < 0 || (size_t)internalIdx >= g_STLStore.size()) return;
+    GDK_STL_Model& m = g_STLStore[internalIdx];
+    if (!m.InUse || m.indices.empty()) return;
+    if (lod >= (int)m.lods.size()) lod = -1;
+    const std::vector<uint32_t>& idx = (lod >= 0) ? m.lods[lod] : m.indices;
+    bool clusters = (lod < 0 && !m.meshlets.Empty());
+    if (clusters && !GDK_Internal_MeshletCull(m.meshlets)) return;
+
+    if (GDK::mode != GDK_MODE_LEGACY) {
+        if (!m.vao) {
+            std::vector<uint32_t> all(m.indices);
+            m.lodFirst.clear();
+            for (const auto& l : m.lods) { m.lodFirst.push_back((uint32_t)all.size()); all.insert(all.end(), l.begin(), l.end()); }
+
+            glGenVertexArrays(1, &m.vao);
+            glGenBuffers(1, &m.vbo);
+            glGenBuffers(1, &m.ebo);
+            glBindVertexArray(m.vao);
+            glBindBuffer(GL_ARRAY_BUFFER, m.vbo);
+            glBufferData(GL_ARRAY_BUFFER, m.vertices.size() * sizeof(GDK_Legacy_Vert), m.vertices.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m.ebo);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, all.size() * 4, all.data(), GL_STATIC_DRAW);
+            glEnableVertexAttribArray(0); // Pos
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GDK_Legacy_Vert), (void*)offsetof(GDK_Legacy_Vert, x));
+            glEnableVertexAttribArray(1); // Normal
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(GDK_Legacy_Vert), (void*)offsetof(GDK_Legacy_Vert, nx));
+            glEnableVertexAttribArray(2); // Tex
+            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GDK_Legacy_Vert), (void*)offsetof(GDK_Legacy_Vert, u));
+        }
+        glBindVertexArray(m.vao);
+        if (clusters) {
+            GDK_Internal_MeshletBind(m.meshlets);
+            GDK_Internal_MeshletDrawGroup(m.meshlets, 0);
+            GDK_Internal_MeshletUnbind();
+        } else {
+            size_t first = (lod >= 0) ? m.lodFirst[lod] : 0;
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m.ebo); // The cluster path may have swapped it
+            glDrawElements(GL_TRIANGLES, (GLsizei)idx.size(), GL_UNSIGNED_INT, (const void*)(first * 4));
+        }
+        glBindVertexArray(0);
+        return;
+    }
+
+    glDisable(GL_TEXTURE_2D);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(GDK_Legacy_Vert), &m.vertices[0].x);
+    glNormalPointer(GL_FLOAT, sizeof(GDK_Legacy_Vert), &m.vertices[0].nx);
+    if (clusters) GDK_Internal_MeshletDrawGroup(m.meshlets, 0);
+    else glDrawElements(GL_TRIANGLES, (GLsizei)idx.size(), GL_UNSIGNED_INT, idx.data());
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+}
+
+static inline bool GDK_Internal_STLIsSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+// Parses the "vertex x y z" lines of [p, end) - three per facet, normals are recomputed anyway
+static bool GDK_Internal_STLParseASCIIRange(const char* p, const char* end, std::vector<float>& out) {
+    const char* start = p;
+    while (p < end) {
+        const char* v = (const char*)memchr(p, 'v', end - p);
+        if (!v) break;
+        p = v + 1;
+        if (end - v < 7 || memcmp(v, "vertex", 6) != 0 || !GDK_Internal_STLIsSpace(v[6])) continue;
+        if (v > start && !GDK_Internal_STLIsSpace(v[-1])) continue;
+        p = v + 6;
+        for (int k = 0; k < 3; ++k) {
+            while (p < end && GDK_Internal_STLIsSpace(*p)) ++p;
+            if (p < end && *p == '+') ++p; // from_chars takes no leading '+'
+            float f;
+            auto res = std::from_chars(p, end, f);
+            if (res.ec != std::errc()) return false;
+            out.push_back(f);
+            p = res.ptr;
+        }
+    }
+    return out.size() % 9 == 0;
+}
+
+// Splits the text at "facet" keywords and parses the pieces on the job pool. Positions only, 9 per facet.
+static bool GDK_Internal_STLParseASCII(const char* text, size_t size, std::vector<float>& out) {
+    int chunks = (int)std::min<size_t>(size / GDK_STL_PARSE_CHUNK + 1, (size_t)(GDK::Jobs::WorkerCount() + 1) * 4);
+    std::vector<const char*> cuts(chunks + 1);
+    cuts[0] = text;
+    cuts[chunks] = text + size;
+    for (int c = 1; c < chunks; ++c) {
+        const char* p = std::max(cuts[c - 1], text + size * c / chunks);
+        const char* end = text + size;
+        // Next "facet" that starts a word (Not the tail of "endfacet")
+        while (p < end) {
+            const char* f = (const char*)memchr(p, 'f', end - p);
+            if (!f) { p = end; break; }
+            if (end - f >= 5 && memcmp(f, "facet", 5) == 0 && f > text && GDK_Internal_STLIsSpace(f[-1])) { p = f; break; }
+            p = f + 1;
+        }
+        cuts[c] = p;
+    }
+
+    std::vector<std::vector<float>> parts(chunks);
+    std::atomic<bool> ok(true);
+    GDK::Jobs::ParallelFor(chunks, 1, [&](int begin, int end) {
+        for (int c = begin; c < end; ++c) {
+            parts[c].reserve((cuts[c + 1] - cuts[c]) / 30); // ~1 float per 30 bytes of typical exports
+            if (!GDK_Internal_STLParseASCIIRange(cuts[c], cuts[c + 1], parts[c])) ok = false;
+        }
+    });
+    if (!ok) return false;
+
+    size_t total = 0;
+    for (const auto& pt : parts) total += pt.size();
+    out.clear();
+    out.reserve(total);
+    for (const auto& pt : parts) out.insert(out.end(), pt.begin(), pt.end());
+    return !out.empty();
+}
+
+// 3. Loader (Binary or ASCII)
+static bool GDK_Internal_LoadSTL(const char* mPath, GDK_STL_Model& model) {
+    auto t0 = std::chrono::steady_clock::now();
+    GDK::Internal::MappedFile file;
+    if (!file.Open(mPath)) return false;
+
+    // Binary headers may begin with "solid" too - a size that matches the triangle count decides it
+    uint32_t fileTris = 0;
+    if (file.size >= 84) memcpy(&fileTris, file.data + 80, 4);
+    bool binary = file.size >= 84 && 84 + (uint64_t)fileTris * sizeof(STL_Triangle) == file.size;
+    if (!binary) {
+        size_t i = 0;
+        while (i < file.size && GDK_Internal_STLIsSpace((char)file.data[i])) ++i;
+        bool ascii = file.size - i >= 5 && memcmp(file.data + i, "solid", 5) == 0;
+        if (!ascii) binary = file.size >= 84 && 84 + (uint64_t)fileTris * sizeof(STL_Triangle) <= file.size; // Trailing junk
+        if (!ascii && !binary) return false;
+    }
+
+    // Corner c of triangle t, wherever the positions live
+    std::vector<float> asciiPos;
+    const uint8_t* base;
+    size_t stride, offset;
+    uint32_t numTris;
+    if (binary) {
+        numTris = fileTris;
+        base = file.data + 84; stride = sizeof(STL_Triangle); offset = offsetof(STL_Triangle, vertex1);
+    } else {
+        if (!GDK_Internal_STLParseASCII((const char*)file.data, file.size, asciiPos)) {
+            printf("[STL] %s: malformed ASCII\n", mPath);
+            return false;
+        }
+        numTris = (uint32_t)(asciiPos.size() / 9);
+        base = (const uint8_t*)asciiPos.data(); stride = 36; offset = 0;
+    }
+    if (numTris == 0) return false;
+    auto Corner = [&](uint32_t c, float* p) { memcpy(p, base + (c / 3) * stride + offset + (c % 3) * 12, 12); };
+    auto t1 = std::chrono::steady_clock::now();
+
+    // Weld 1: position
+    uint32_t numCorners = numTris * 3;
+    std::vector<uint32_t> posId, posFirst;
+    GDK_Internal_HashWeld<3>(numCorners, [&](uint32_t c, uint32_t* k) {
+        float p[3];
+        Corner(c, p);
+        for (int i = 0; i < 3; ++i) k[i] = GDK_Internal_WeldFloatKey(p[i]);
+    }, posId, posFirst);
+    std::vector<glm::vec3> pos(posFirst.size());
+    for (size_t i = 0; i < posFirst.size(); ++i) { float p[3]; Corner(posFirst[i], p); pos[i] = glm::vec3(p[0], p[1], p[2]); }
+
+    // Drop triangles that welded degenerate, and take area-weighted face normals
+    std::vector<uint32_t> tris;
+    tris.reserve(numCorners);
+    for (uint32_t t = 0; t < numTris; ++t) {
+        uint32_t a = posId[t * 3], b = posId[t * 3 + 1], c = posId[t * 3 + 2];
+        if (a == b || b == c || a == c) continue;
+        tris.insert(tris.end(), { a, b, c });
+    }
+    std::vector<uint32_t>().swap(posId);
+    numTris = (uint32_t)(tris.size() / 3);
+    numCorners = numTris * 3;
+    if (numTris == 0) return false;
+    std::vector<glm::vec3> faceN(numTris);
+    for (uint32_t t = 0; t < numTris; ++t)
+        faceN[t] = glm::cross(pos[tris[t * 3 + 1]] - pos[tris[t * 3]], pos[tris[t * 3 + 2]] - pos[tris[t * 3]]);
+
+    // Corner normals: faces around the corner's position within the crease angle, area weighted
+    std::vector<glm::vec3> cornerN(numCorners);
+    auto Unit = [](const glm::vec3& n) { float l = glm::length(n); return l > 0.0f ? n / l : glm::vec3(0.0f); };
+    if (g_STLSmoothAngle > 0.0f) {
+        std::vector<uint32_t> adjStart(pos.size() + 1, 0), adj(numCorners);
+        for (uint32_t c = 0; c < numCorners; ++c) adjStart[tris[c] + 1]++;
+        for (size_t i = 0; i < pos.size(); ++i) adjStart[i + 1] += adjStart[i];
+        std::vector<uint32_t> fill(adjStart.begin(), adjStart.end() - 1);
+        for (uint32_t c = 0; c < numCorners; ++c) adj[fill[tris[c]]++] = c / 3;
+
+        float cosT = std::cos(glm::radians(std::min(g_STLSmoothAngle, 180.0f)));
+        GDK::Jobs::ParallelFor((int)numTris, 4096, [&](int begin, int end) {
+            for (int t = begin; t < end; ++t) {
+                glm::vec3 nf = Unit(faceN[t]);
+                for (int k = 0; k < 3; ++k) {
+                    uint32_t p = tris[t * 3 + k];
+                    glm::vec3 sum(0.0f);
+                    for (uint32_t a = adjStart[p]; a < adjStart[p + 1]; ++a) {
+                        const glm::vec3& ng = faceN[adj[a]];
+                        if (glm::dot(nf, Unit(ng)) >= cosT) sum += ng;
+                    }
+                    cornerN[t * 3 + k] = Unit(sum);
+                }
+            }
+        });
+    } else {
+        for (uint32_t c = 0; c < numCorners; ++c) cornerN[c] = Unit(faceN[c / 3]);
+    }
+    std::vector<glm::vec3>().swap(faceN);
+
+    // Weld 2: (position, normal) -> final vertices
+    std::vector<uint32_t> vertFirst;
+    GDK_Internal_HashWeld<4>(numCorners, [&](uint32_t c, uint32_t* k) {
+        k[0] = tris[c];
+        k[1] = GDK_Internal_WeldFloatKey(cornerN[c].x);
+        k[2] = GDK_Internal_WeldFloatKey(cornerN[c].y);
+        k[3] = GDK_Internal_WeldFloatKey(cornerN[c].z);
+    }, model.indices, vertFirst);
+    model.vertices.resize(vertFirst.size());
+    for (size_t i = 0; i < vertFirst.size(); ++i) {
+        const glm::vec3& p = pos[tris[vertFirst[i]]];
+        const glm::vec3& n = cornerN[vertFirst[i]];
+        GDK_Legacy_Vert& v = model.vertices[i];
+        v.x = p.x; v.y = p.y; v.z = p.z;
+        v.nx = n.x; v.ny = n.y; v.nz = n.z;
+        v.u = 0; v.v = 0;
+    }
+    model.numTris = numTris;
+    GDK_Internal_ComputeBounds(model.vertices.data(), model.vertices.size(), model.bounds);
+    auto t2 = std::chrono::steady_clock::now();
+
+    if (numTris >= GDK_MESHLET_MIN_TRIS)
+        GDK_Internal_BuildMeshlets(model.vertices.data(), model.vertices.size(), model.indices.data(), model.indices.size(), model.meshlets);
+    auto t3 = std::chrono::steady_clock::now();
+
+    double unrolledMB = numCorners * sizeof(GDK_Legacy_Vert) / (1024.0 * 1024.0);
+    double weldedMB = (model.vertices.size() * sizeof(GDK_Legacy_Vert) + model.indices.size() * 4) / (1024.0 * 1024.0);
+    printf("[STL] %s: %s, %u tris -> %u verts (%.1f MB vs %.1f MB unrolled), %u clusters, read %.1f ms, weld %.1f ms, cluster %.1f ms\n", mPath,
+           binary ? "binary" : "ascii", numTris, (uint32_t)model.vertices.size(), weldedMB, unrolledMB, (uint32_t)model.meshlets.meshlets.size(),
+           std::chrono::duration<double, std::milli>(t1 - t0).count(), std::chrono::duration<double, std::milli>(t2 - t1).count(),
+           std::chrono::duration<double, std::milli>(t3 - t2).count());
+    return true;
+}
+
+GDK_BEGIN_DECLS
+
+// Crease angle for STL normals, applied at load (Default 30). <= 0 keeps flat facet normals.
+GDK_API void GDK_Model_SetSTLSmoothing(float degrees) { g_STLSmoothAngle = degrees; }
+
+GDK_END_DECLS
+
+#endif
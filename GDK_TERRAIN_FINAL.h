@@ -1,246 +1,680 @@
-#ifndef GDK_TERRAIN_H
-#define GDK_TERRAIN_H
-
-// --- Terrain System ---
-#pragma pack(push, 1)
-struct TerrainVertex {
-    float x, y, z;    // Position First (S-Tier Standard)
-    float nx, ny, nz; // Normals Second
-    float u, v;       // UVs Last
-};
-#pragma pack(pop)
-
-struct GDK_Internal_Terrain {
-    uint32_t textureID;
-    uint32_t displayList; // Legacy (Mode 0)
-    uint32_t vao, vbo, ebo; // Standard/AZDO (Mode 1 & 2)
-    void* azdoPtr;        // Persistent Mapping (Mode 2)
-    
-    int width, height;
-    float scaleXZ, scaleY;
-    uint32_t indexCount;
-};
-
-static std::vector<GDK_Internal_Terrain> g_Terrains;
-static std::vector<std::vector<float>> g_HeightGrid;
-
-// 2026 Optimized Normal Calculation (Baking scale in)
-static glm::vec3 CalculateNormal(int x, int z, int w, int h, const std::vector<float>& heights, float scaleXZ) {
-    float hL = (x > 0) ? heights[z * w + (x - 1)] : heights[z * w + x];
-    float hR = (x < w - 1) ? heights[z * w + (x + 1)] : heights[z * w + x];
-    float hD = (z > 0) ? heights[(z - 1) * w + x] : heights[z * w + x];
-    float hU = (z < h - 1) ? heights[(z + 1) * w + x] : heights[z * w + x];
-    // ScaleXZ factors into the cross product intensity
-    return glm::normalize(glm::vec3(hL - hR, 2.0f * scaleXZ, hD - hU));
-}
-
-
-// Internal global for the terrain shader
-static uint32_t g_TerrainShader = 0;
-
-// Internal accessor that the terrain render call is looking for
-static inline uint32_t GDK_GetTerrainShader() {
-    return g_TerrainShader;
-}
-
-// Simple Box Blur for Heightmap Smoothing Makes a big difference!
-void ApplyBoxBlur(unsigned char* data, int width, int height, int kernelSize) {
-    // We create a temporary buffer to store the blurred results
-    unsigned char* temp_data = new unsigned char[width * height];
-    
-    int halfKernel = kernelSize / 2;
-
-    for (int z = 0; z < height; z++) {
-        for (int x = 0; x < width; x++) {
-            float sum = 0.0f;
-            int count = 0;
-
-            // Iterate over the kernel window
-            for (int kz = -halfKernel; kz <= halfKernel; kz++) {
-                for (int kx = -halfKernel; kx <= halfKernel; kx++) {
-                    int sampleX = x + kx;
-                    int sampleZ = z + kz;
-
-                    // Check boundaries
-                    if (sampleX >= 0 && sampleX < width && sampleZ >= 0 && sampleZ < height) {
-                        sum += data[sampleZ * width + sampleX];
-                        count++;
-                    }
-                }
-            }
-            temp_data[z * width + x] = (unsigned char)(sum / count);
-        }
-    }
-    
-    // Copy the blurred data back to the original array
-    memcpy(data, temp_data, width * height * sizeof(unsigned char));
-    delete[] temp_data;
-}
-
-
-
-GDK_BEGIN_DECLS
-
-GDK_API int GDK_LoadTerrain(const char* heightmapPath, const char* texturePath, float scaleXZ, float scaleY) {
-    int imgW, imgH, imgC;
-    stbi_set_flip_vertically_on_load(true); 
-    unsigned char* data = stbi_load(heightmapPath, &imgW, &imgH, &imgC, 1);
-    if (!data) return -1;
-    ApplyBoxBlur(data, imgW, imgH, 3); // Use a kernel size of 3
-    ApplyBoxBlur(data, imgW, imgH, 3); // Use a kernel size of 3
-    ApplyBoxBlur(data, imgW, imgH, 3); // Use a kernel size of 3
-
-    GDK_Internal_Terrain terrain = {};
-    terrain.width = imgW; terrain.height = imgH;
-    terrain.scaleXZ = scaleXZ; terrain.scaleY = scaleY;
-    terrain.textureID = GDK_LoadTexture(texturePath);
-
-    std::vector<TerrainVertex> verts(imgW * imgH);
-    std::vector<float> rawHeights(imgW * imgH);
-    g_HeightGrid.assign(imgW, std::vector<float>(imgH));
-
-    // 1. Bake Vertex Positions and Store HeightGrid
-    for (int z = 0; z < imgH; z++) {
-        for (int x = 0; x < imgW; x++) {
-            int i = z * imgW + x;
-            float worldY = ((float)data[i] / 255.0f) * 15.0f * scaleY;
-            verts[i].x = (float)x * scaleXZ;
-            verts[i].y = worldY;
-            verts[i].z = (float)z * scaleXZ;
-            verts[i].u = (float)x / (imgW - 1);
-            verts[i].v = (float)z / (imgH - 1);
-            
-            rawHeights[i] = worldY;
-            g_HeightGrid[x][z] = worldY;
-        }
-    }
-    stbi_image_free(data);
-
-    // 2. Calculate Baked Normals
-    for (int z = 0; z < imgH; z++) {
-        for (int x = 0; x < imgW; x++) {
-            glm::vec3 n = CalculateNormal(x, z, imgW, imgH, rawHeights, scaleXZ);
-            verts[z * imgW + x].nx = n.x;
-            verts[z * imgW + x].ny = n.y;
-            verts[z * imgW + x].nz = n.z;
-        }
-    }
-
-    // 3. Index Generation
-    std::vector<uint32_t> indices;
-    for (int z = 0; z < imgH - 1; z++) {
-        for (int x = 0; x < imgW - 1; x++) {
-            uint32_t v1 = z * imgW + x;
-            uint32_t v2 = z * imgW + (x + 1);
-            uint32_t v3 = (z + 1) * imgW + x;
-            uint32_t v4 = (z + 1) * imgW + (x + 1);
-            indices.insert(indices.end(), { v1, v3, v4, v1, v4, v2 });
-        }
-    }
-    terrain.indexCount = (uint32_t)indices.size();
-
-    // 4. Branching Render Mode Setup
-    if (GDK::mode == GDK_MODE_LEGACY) {
-        terrain.displayList = glGenLists(1);
-        glNewList(terrain.displayList, GL_COMPILE);
-        glBegin(GL_TRIANGLES);
-        for (auto idx : indices) {
-            glNormal3f(verts[idx].nx, verts[idx].ny, verts[idx].nz);
-            glTexCoord2f(verts[idx].u, verts[idx].v);
-            glVertex3f(verts[idx].x, verts[idx].y, verts[idx].z);
-        }
-        glEnd();
-        glEndList();
-    } 
-    else {
-        glGenVertexArrays(1, &terrain.vao);
-        glGenBuffers(1, &terrain.vbo);
-        glGenBuffers(1, &terrain.ebo);
-        glBindVertexArray(terrain.vao);
-
-        glBindBuffer(GL_ARRAY_BUFFER, terrain.vbo);
-        if (GDK::mode == GDK_MODE_AZDO) {
-            // Persistent Mapping for 2026 Hardware
-            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
-            glBufferStorage(GL_ARRAY_BUFFER, verts.size() * sizeof(TerrainVertex), verts.data(), flags);
-            terrain.azdoPtr = glMapBufferRange(GL_ARRAY_BUFFER, 0, verts.size() * sizeof(TerrainVertex), flags);
-        } else {
-            glBufferData(GL_ARRAY_BUFFER, verts.size() * sizeof(TerrainVertex), verts.data(), GL_STATIC_DRAW);
-        }
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, terrain.ebo);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
-
-        glEnableVertexAttribArray(0); // Pos
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, x));
-        glEnableVertexAttribArray(1); // Normal
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, nx));
-        glEnableVertexAttribArray(2); // Tex
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, u));
-        glBindVertexArray(0);
-    }
-
-    g_Terrains.push_back(terrain);
-    return (int)g_Terrains.size() - 1;
-}
-
-GDK_API float GDK_GetTerrainHeight(int terrainIdx, float worldX, float worldZ) {
-    if (terrainIdx < 0 || (size_t)terrainIdx >= g_Terrains.size()) return 0.0f;
-    auto& t = g_Terrains[terrainIdx];
-
-    float gridX = worldX / t.scaleXZ;
-    float gridZ = worldZ / t.scaleXZ;
-
-    int x0 = (int)std::floor(gridX);
-    int z0 = (int)std::floor(gridZ);
-    
-    if (x0 < 0 || x0 >= t.width - 1 || z0 < 0 || z0 >= t.height - 1) return 0.0f;
-
-    float fracX = gridX - (float)x0;
-    float fracZ = gridZ - (float)z0;
-
-    // Data is already pre-scaled in g_HeightGrid
-    float h00 = g_HeightGrid[x0][z0];
-    float h10 = g_HeightGrid[x0 + 1][z0];
-    float h01 = g_HeightGrid[x0][z0 + 1];
-    float h11 = g_HeightGrid[x0 + 1][z0 + 1];
-
-    float top = h00 + (h10 - h00) * fracX;
-    float bottom = h01 + (h11 - h01) * fracX;
-    return top + (bottom - top) * fracZ;
-}
-
-GDK_API void GDK_RenderTerrain(int terrainIdx) {
-    if (terrainIdx < 0 || (size_t)terrainIdx >= g_Terrains.size()) return;
-    auto& t = g_Terrains[terrainIdx];
-
-    // 1. Get the Mode-Specific Key
-    uint64_t texKey = g_Textures[t.textureID];
-
-    // 2. Texture Application Branch
-    if (GDK::mode == GDK_MODE_AZDO) {
-        // AZDO: No binding! Just upload the 64-bit handle to the shader uniform.
-        // This is extremely fast as it involves zero driver state changes.
-        uint32_t shader = GDK_GetTerrainShader(); 
-        glUseProgram(shader);
-        glUniformHandleui64ARB(glGetUniformLocation(shader, "u_Texture"), texKey);
-    } 
-    else {
-        // LEGACY/STANDARD: Standard binding.
-        glEnable(GL_TEXTURE_2D); // Required for Mode 0
-        glBindTexture(GL_TEXTURE_2D, texKey);
-    }
-
-    // 3. Drawing Branch
-    if (GDK::mode == GDK_MODE_LEGACY) {
-        glCallList(t.displayList);
-    } else {
-        glBindVertexArray(t.vao);
-        glDrawElements(GL_TRIANGLES, t.indexCount, GL_UNSIGNED_INT, 0);
-    }
-}
-
-
-GDK_END_DECLS
-
-#endif 
+#ifndef GDK_TERRAIN_H
+#define GDK_TERRAIN_H
+
+// --- Terrain System ---
+#pragma pack(push, 1)
+struct TerrainVertex {
+    float x, y, z;    // Position First (S-Tier Standard)
+    float nx, ny, nz; // Normals Second
+    float u, v;       // UVs Last
+};
+#pragma pack(pop)
+
+enum GDK_TerrainPhase {
+    TERRAIN_PHASE_DECODE = 0, TERRAIN_PHASE_POSITIONS = 1, TERRAIN_PHASE_NORMALS = 2,
+    TERRAIN_PHASE_INDICES = 3, TERRAIN_PHASE_UPLOAD = 4, TERRAIN_PHASE_COUNT = 5
+};
+
+#define GDK_TERRAIN_CHUNK 64 // Quads per chunk edge (Legacy lists + vertex pulling grid)
+
+struct GDK_Internal_Terrain {
+    uint32_t textureID;
+    std::vector<uint32_t> chunkLists; // Legacy (Mode 0) - one display list per chunk
+    uint32_t vao, vbo, ebo; // Standard/AZDO (Mode 1 & 2)
+    void* azdoPtr;        // Persistent Mapping (Mode 2)
+    GLsync fence;         // Last AZDO draw, waited on before writing through azdoPtr
+    
+    int width, height;
+    float scaleXZ, scaleY;
+    uint32_t indexCount;
+    std::vector<float> heights; // World heights (width * height) - source of truth for edits
+
+    // Vertex Pulling (Mode 1 & 2): only a height texture lives on the GPU
+    bool pulled;
+    uint32_t heightTex;   // GL_R32F world heights
+    int chunksX, chunksZ; // Chunk grid (Instances when pulled, display lists in Legacy)
+
+    float buildMs[TERRAIN_PHASE_COUNT]; // Per-phase load timings
+};
+
+static std::vector<GDK_Internal_Terrain> g_Terrains;
+
+// 2026 Optimized Normal Calculation (Baking scale in)
+static glm::vec3 CalculateNormal(int x, int z, int w, int h, const std::vector<float>& heights, float scaleXZ) {
+    float hL = (x > 0) ? heights[z * w + (x - 1)] : heights[z * w + x];
+    float hR = (x < w - 1) ? heights[z * w + (x + 1)] : heights[z * w + x];
+    float hD = (z > 0) ? heights[(z - 1) * w + x] : heights[z * w + x];
+    float hU = (z < h - 1) ? heights[(z + 1) * w + x] : heights[z * w + x];
+    // ScaleXZ factors into the cross product intensity
+    return glm::normalize(glm::vec3(hL - hR, 2.0f * scaleXZ, hD - hU));
+}
+
+
+// Internal global for the terrain shader
+static uint32_t g_TerrainShader = 0;
+
+// Internal accessor that the terrain render call is looking for
+static inline uint32_t GDK_GetTerrainShader() {
+    return g_TerrainShader;
+}
+
+// Shared texture bind for every terrain path (Resident + Streamed)
+static void GDK_Internal_BindTerrainTexture(uint32_t textureID) {
+    if (textureID >= g_Textures.size()) return; // Failed texture load (-1)
+    GDK_Internal_MipStreamRequest((int)textureID, 0); // Terrain fills the screen up close - always full detail
+
+    // 1. Texture Application Branch
+    if (GDK_Internal_BindlessAvailable()) {
+        // AZDO: No binding! The slot is made resident and the active program picks it by index
+        // from the bindless table (u_TextureIndex) or takes the raw 64-bit handle (u_Texture).
+        uint64_t handle = GDK_Internal_TextureHandle((int)textureID);
+        GLint shader = 0;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &shader);
+        if (shader) {
+            GLint idxLoc = glGetUniformLocation(shader, "u_TextureIndex");
+            if (idxLoc >= 0) glUniform1i(idxLoc, (GLint)textureID);
+            else glUniformHandleui64ARB(glGetUniformLocation(shader, "u_Texture"), handle);
+        }
+    } 
+    else {
+        // LEGACY/STANDARD: Standard binding.
+        if (GDK::mode == GDK_MODE_LEGACY) glEnable(GL_TEXTURE_2D); // Required for Mode 0
+        glBindTexture(GL_TEXTURE_2D, g_Textures[textureID]);
+    }
+}
+
+// Simple Box Blur for Heightmap Smoothing Makes a big difference!
+void ApplyBoxBlur(unsigned char* data, int width, int height, int kernelSize) {
+    // We create a temporary buffer to store the blurred results
+    unsigned char* temp_data = new unsigned char[width * height];
+    
+    int halfKernel = kernelSize / 2;
+
+    for (int z = 0; z < height; z++) {
+        for (int x = 0; x < width; x++) {
+            float sum = 0.0f;
+            int count = 0;
+
+            // Iterate over the kernel window
+            for (int kz = -halfKernel; kz <= halfKernel; kz++) {
+                for (int kx = -halfKernel; kx <= halfKernel; kx++) {
+                    int sampleX = x + kx;
+                    int sampleZ = z + kz;
+
+                    // Check boundaries
+                    if (sampleX >= 0 && sampleX < width && sampleZ >= 0 && sampleZ < height) {
+                        sum += data[sampleZ * width + sampleX];
+                        count++;
+                    }
+                }
+            }
+            temp_data[z * width + x] = (unsigned char)(sum / count);
+        }
+    }
+    
+    // Copy the blurred data back to the original array
+    memcpy(data, temp_data, width * height * sizeof(unsigned char));
+    delete[] temp_data;
+}
+
+
+
+// Rebuilds one vertex from the height grid (Used by edits - the load path bakes in bulk)
+static TerrainVertex GDK_Internal_MakeTerrainVertex(const GDK_Internal_Terrain& t, int x, int z) {
+    TerrainVertex v;
+    v.x = (float)x * t.scaleXZ;
+    v.y = t.heights[z * t.width + x];
+    v.z = (float)z * t.scaleXZ;
+    v.u = (float)x / (t.width - 1);
+    v.v = (float)z / (t.height - 1);
+    glm::vec3 n = CalculateNormal(x, z, t.width, t.height, t.heights, t.scaleXZ);
+    v.nx = n.x; v.ny = n.y; v.nz = n.z;
+    return v;
+}
+
+// Legacy: (Re)compiles the display list of chunk cx,cz. V(x, z) supplies the vertex at a grid point.
+template <typename F>
+static void GDK_Internal_CompileTerrainChunk(GDK_Internal_Terrain& t, int cx, int cz, F V) {
+    uint32_t& list = t.chunkLists[cz * t.chunksX + cx];
+    if (!list) list = glGenLists(1);
+
+    int x0 = cx * GDK_TERRAIN_CHUNK, x1 = std::min(x0 + GDK_TERRAIN_CHUNK, t.width - 1);
+    int z0 = cz * GDK_TERRAIN_CHUNK, z1 = std::min(z0 + GDK_TERRAIN_CHUNK, t.height - 1);
+
+    glNewList(list, GL_COMPILE);
+    glBegin(GL_TRIANGLES);
+    for (int z = z0; z < z1; z++) {
+        for (int x = x0; x < x1; x++) {
+            // Same winding as the index buffer: v1, v3, v4, v1, v4, v2
+            const int cornerX[6] = { x, x, x + 1, x, x + 1, x + 1 };
+            const int cornerZ[6] = { z, z + 1, z + 1, z, z + 1, z };
+            for (int c = 0; c < 6; c++) {
+                const TerrainVertex& v = V(cornerX[c], cornerZ[c]);
+                glNormal3f(v.nx, v.ny, v.nz);
+                glTexCoord2f(v.u, v.v);
+                glVertex3f(v.x, v.y, v.z);
+            }
+        }
+    }
+    glEnd();
+    glEndList();
+}
+
+// --- PARALLEL MESH BUILD ---
+// Rows are split into bands across the worker pool. Every phase writes into pre-sized
+// storage (the mapped GL buffers in Mode 1 & 2), so no band ever touches another's memory.
+
+static float GDK_Internal_TerrainLap(std::chrono::high_resolution_clock::time_point& t) {
+    auto now = std::chrono::high_resolution_clock::now();
+    float ms = std::chrono::duration<float, std::milli>(now - t).count();
+    t = now;
+    return ms;
+}
+
+// 'heights' are final world heights (width * height, row-major). Fills everything but textureID.
+static void GDK_Internal_BuildTerrainMesh(GDK_Internal_Terrain& terrain, const std::vector<float>& heights) {
+    const int w = terrain.width, h = terrain.height;
+    const float scaleXZ = terrain.scaleXZ;
+    const size_t vertBytes = (size_t)w * h * sizeof(TerrainVertex);
+    const size_t indexCount = (size_t)(w - 1) * (h - 1) * 6;
+    const int band = 16; // Rows per job
+    terrain.indexCount = (uint32_t)indexCount;
+
+    auto t = std::chrono::high_resolution_clock::now();
+
+    // Destination: mapped GL memory for Mode 1 & 2, CPU arrays for the Mode 0 display list
+    std::vector<TerrainVertex> cpuVerts;
+    std::vector<uint32_t> cpuIndices;
+    TerrainVertex* verts = nullptr;
+    uint32_t* indices = nullptr;
+
+    if (GDK::mode != GDK_MODE_LEGACY) {
+        glGenVertexArrays(1, &terrain.vao);
+        glGenBuffers(1, &terrain.vbo);
+        glGenBuffers(1, &terrain.ebo);
+        glBindVertexArray(terrain.vao);
+
+        glBindBuffer(GL_ARRAY_BUFFER, terrain.vbo);
+        if (GDK::mode == GDK_MODE_AZDO) {
+            // Persistent Mapping for 2026 Hardware - the workers write straight into it
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, vertBytes, nullptr, flags | GL_DYNAMIC_STORAGE_BIT); // Dynamic = SubData fallback stays legal
+            terrain.azdoPtr = glMapBufferRange(GL_ARRAY_BUFFER, 0, vertBytes, flags);
+            verts = (TerrainVertex*)terrain.azdoPtr;
+        } else {
+            glBufferData(GL_ARRAY_BUFFER, vertBytes, nullptr, GL_STATIC_DRAW);
+            verts = (TerrainVertex*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vertBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        }
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, terrain.ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(uint32_t), nullptr, GL_STATIC_DRAW);
+        indices = (uint32_t*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indexCount * sizeof(uint32_t), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    }
+
+    // Legacy, or the driver refused the mapping: build on the CPU and copy after
+    if (!verts)   { cpuVerts.resize((size_t)w * h);   verts = cpuVerts.data(); }
+    if (!indices) { cpuIndices.resize(indexCount);    indices = cpuIndices.data(); }
+
+    terrain.buildMs[TERRAIN_PHASE_UPLOAD] = GDK_Internal_TerrainLap(t); // Buffer allocation counts as upload
+
+    // 1. Bake Vertex Positions
+    GDK::Jobs::ParallelFor(h, band, [&](int z0, int z1) {
+        for (int z = z0; z < z1; z++) {
+            for (int x = 0; x < w; x++) {
+                int i = z * w + x;
+                verts[i].x = (float)x * scaleXZ;
+                verts[i].y = heights[i];
+                verts[i].z = (float)z * scaleXZ;
+                verts[i].u = (float)x / (w - 1);
+                verts[i].v = (float)z / (h - 1);
+            }
+        }
+    });
+    terrain.buildMs[TERRAIN_PHASE_POSITIONS] = GDK_Internal_TerrainLap(t);
+
+    // 2. Calculate Baked Normals
+    GDK::Jobs::ParallelFor(h, band, [&](int z0, int z1) {
+        for (int z = z0; z < z1; z++) {
+            for (int x = 0; x < w; x++) {
+                glm::vec3 n = CalculateNormal(x, z, w, h, heights, scaleXZ);
+                verts[z * w + x].nx = n.x;
+                verts[z * w + x].ny = n.y;
+                verts[z * w + x].nz = n.z;
+            }
+        }
+    });
+    terrain.buildMs[TERRAIN_PHASE_NORMALS] = GDK_Internal_TerrainLap(t);
+
+    // 3. Index Generation (Each quad row owns a fixed slice of the index buffer)
+    GDK::Jobs::ParallelFor(h - 1, band, [&](int z0, int z1) {
+        for (int z = z0; z < z1; z++) {
+            uint32_t* out = indices + (size_t)z * (w - 1) * 6;
+            for (int x = 0; x < w - 1; x++) {
+                uint32_t v1 = z * w + x;
+                uint32_t v2 = z * w + (x + 1);
+                uint32_t v3 = (z + 1) * w + x;
+                uint32_t v4 = (z + 1) * w + (x + 1);
+                out[0] = v1; out[1] = v3; out[2] = v4;
+                out[3] = v1; out[4] = v4; out[5] = v2;
+                out += 6;
+            }
+        }
+    });
+    terrain.buildMs[TERRAIN_PHASE_INDICES] = GDK_Internal_TerrainLap(t);
+
+    // 4. Branching Render Mode Setup
+    if (GDK::mode == GDK_MODE_LEGACY) {
+        // Chunked so a height edit only recompiles the lists it touches
+        terrain.chunksX = (w - 1 + GDK_TERRAIN_CHUNK - 1) / GDK_TERRAIN_CHUNK;
+        terrain.chunksZ = (h - 1 + GDK_TERRAIN_CHUNK - 1) / GDK_TERRAIN_CHUNK;
+        terrain.chunkLists.assign((size_t)terrain.chunksX * terrain.chunksZ, 0);
+        for (int cz = 0; cz < terrain.chunksZ; cz++) {
+            for (int cx = 0; cx < terrain.chunksX; cx++) {
+                GDK_Internal_CompileTerrainChunk(terrain, cx, cz, [&](int x, int z) -> const TerrainVertex& { return verts[z * w + x]; });
+            }
+        }
+    }
+    else {
+        // VAO is still bound from the allocation step
+        glBindBuffer(GL_ARRAY_BUFFER, terrain.vbo);
+        if (!cpuVerts.empty()) glBufferSubData(GL_ARRAY_BUFFER, 0, vertBytes, cpuVerts.data());
+        else if (GDK::mode != GDK_MODE_AZDO) glUnmapBuffer(GL_ARRAY_BUFFER);
+
+        if (!cpuIndices.empty()) glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indexCount * sizeof(uint32_t), cpuIndices.data());
+        else glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+        glEnableVertexAttribArray(0); // Pos
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, x));
+        glEnableVertexAttribArray(1); // Normal
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, nx));
+        glEnableVertexAttribArray(2); // Tex
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, u));
+        glBindVertexArray(0);
+    }
+    terrain.buildMs[TERRAIN_PHASE_UPLOAD] += GDK_Internal_TerrainLap(t);
+
+    printf("[TERRAIN] %dx%d on %d threads: decode %.2fms | positions %.2fms | normals %.2fms | indices %.2fms | upload %.2fms\n",
+           w, h, GDK::Jobs::WorkerCount() + 1,
+           terrain.buildMs[TERRAIN_PHASE_DECODE], terrain.buildMs[TERRAIN_PHASE_POSITIONS], terrain.buildMs[TERRAIN_PHASE_NORMALS],
+           terrain.buildMs[TERRAIN_PHASE_INDICES], terrain.buildMs[TERRAIN_PHASE_UPLOAD]);
+}
+
+
+// --- VERTEX PULLING PATH (Mode 1 & 2) ---
+// x/z/u/v are implied by the grid index and the normal comes from neighbouring heights,
+// so the GPU only keeps one float per sample (4 bytes vs 32 + 24 of indices per quad).
+// One shared chunk grid is drawn instanced; gl_InstanceID picks the chunk offset.
+
+
+static bool g_TerrainPulling = false; // Set by GDK_Terrain_SetVertexPulling
+static uint32_t g_TerrainVPShader = 0;
+
+struct GDK_Internal_TerrainGrid {
+    uint32_t vao = 0, ebo = 0;
+    uint32_t indexCount = 0;
+};
+static GDK_Internal_TerrainGrid g_TerrainGrid;
+
+static const char* g_TerrainVP_VS = R"(#version 330 core
+uniform mat4 u_Proj;
+uniform mat4 u_View;
+uniform sampler2D u_Height;
+uniform float u_ScaleXZ;
+uniform int u_ChunkSize;
+uniform int u_ChunksX;
+out vec3 v_Normal;
+out vec2 v_UV;
+
+float H(ivec2 p) {
+    p = clamp(p, ivec2(0), textureSize(u_Height, 0) - 1); // Same edge clamp as CalculateNormal
+    return texelFetch(u_Height, p, 0).r;
+}
+
+void main() {
+    ivec2 size  = textureSize(u_Height, 0);
+    ivec2 chunk = ivec2(gl_InstanceID % u_ChunksX, gl_InstanceID / u_ChunksX);
+    ivec2 local = ivec2(gl_VertexID % (u_ChunkSize + 1), gl_VertexID / (u_ChunkSize + 1));
+    ivec2 g = min(chunk * u_ChunkSize + local, size - 1); // Overhang collapses to zero-area tris
+
+    v_Normal = normalize(vec3(H(g - ivec2(1, 0)) - H(g + ivec2(1, 0)), 2.0 * u_ScaleXZ,
+                              H(g - ivec2(0, 1)) - H(g + ivec2(0, 1))));
+    v_UV = vec2(g) / vec2(size - 1);
+    gl_Position = u_Proj * u_View * vec4(float(g.x) * u_ScaleXZ, H(g), float(g.y) * u_ScaleXZ, 1.0);
+}
+)";
+
+static const char* g_TerrainVP_FS = R"(#version 330 core
+uniform sampler2D u_Texture;
+uniform vec3 u_LightDir;
+uniform vec3 u_LightColor;
+uniform vec3 u_Ambient;
+in vec3 v_Normal;
+in vec2 v_UV;
+out vec4 o_Color;
+
+void main() {
+    vec3 n = normalize(v_Normal);
+    vec3 light = u_Ambient + u_LightColor * max(dot(n, -u_LightDir), 0.0);
+    vec4 tex = texture(u_Texture, v_UV);
+    o_Color = vec4(tex.rgb * light, tex.a);
+}
+)";
+
+// Lazily builds the shader and the shared chunk grid
+static bool GDK_Internal_InitTerrainVP() {
+    if (g_TerrainVPShader && g_TerrainGrid.vao) return true;
+
+    g_TerrainVPShader = GDK::Internal::CompileProgram(g_TerrainVP_VS, g_TerrainVP_FS);
+    if (!g_TerrainVPShader) return false;
+    glUseProgram(g_TerrainVPShader);
+    glUniform1i(glGetUniformLocation(g_TerrainVPShader, "u_Height"), 0);
+    glUniform1i(glGetUniformLocation(g_TerrainVPShader, "u_Texture"), 1);
+    glUniform1i(glGetUniformLocation(g_TerrainVPShader, "u_ChunkSize"), GDK_TERRAIN_CHUNK);
+    glUseProgram(0);
+
+    const int n = GDK_TERRAIN_CHUNK + 1; // (64+1)^2 ids fit in uint16 indices
+    std::vector<uint16_t> grid;
+    grid.reserve(GDK_TERRAIN_CHUNK * GDK_TERRAIN_CHUNK * 6);
+    for (int z = 0; z < n - 1; z++) {
+        for (int x = 0; x < n - 1; x++) {
+            uint16_t v1 = (uint16_t)(z * n + x);
+            uint16_t v2 = (uint16_t)(z * n + (x + 1));
+            uint16_t v3 = (uint16_t)((z + 1) * n + x);
+            uint16_t v4 = (uint16_t)((z + 1) * n + (x + 1));
+            grid.insert(grid.end(), { v1, v3, v4, v1, v4, v2 });
+        }
+    }
+    g_TerrainGrid.indexCount = (uint32_t)grid.size();
+
+    // No attributes at all - the VAO only carries the index buffer
+    glGenVertexArrays(1, &g_TerrainGrid.vao);
+    glGenBuffers(1, &g_TerrainGrid.ebo);
+    glBindVertexArray(g_TerrainGrid.vao);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_TerrainGrid.ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, grid.size() * sizeof(uint16_t), grid.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    return true;
+}
+
+// Replaces the vertex/index build when vertex pulling is on. Height edits become glTexSubImage2D.
+static bool GDK_Internal_BuildTerrainHeightTex(GDK_Internal_Terrain& terrain, const std::vector<float>& heights) {
+    if (!GDK_Internal_InitTerrainVP()) return false;
+    const int w = terrain.width, h = terrain.height;
+    auto t = std::chrono::high_resolution_clock::now();
+
+    glGenTextures(1, &terrain.heightTex);
+    glBindTexture(GL_TEXTURE_2D, terrain.heightTex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, w, h, 0, GL_RED, GL_FLOAT, heights.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    terrain.pulled = true;
+    terrain.chunksX = (w - 1 + GDK_TERRAIN_CHUNK - 1) / GDK_TERRAIN_CHUNK;
+    terrain.chunksZ = (h - 1 + GDK_TERRAIN_CHUNK - 1) / GDK_TERRAIN_CHUNK;
+    terrain.indexCount = g_TerrainGrid.indexCount;
+    terrain.buildMs[TERRAIN_PHASE_UPLOAD] = GDK_Internal_TerrainLap(t);
+
+    printf("[TERRAIN] %dx%d vertex pulled: %d chunks, %.2f MB heights (vs %.2f MB mesh) | upload %.2fms\n",
+           w, h, terrain.chunksX * terrain.chunksZ,
+           (w * h * sizeof(float)) / (1024.0f * 1024.0f),
+           (w * h * sizeof(TerrainVertex) + (size_t)(w - 1) * (h - 1) * 6 * sizeof(uint32_t)) / (1024.0f * 1024.0f),
+           terrain.buildMs[TERRAIN_PHASE_UPLOAD]);
+    return true;
+}
+
+static void GDK_Internal_RenderTerrainVP(const GDK_Internal_Terrain& t) {
+    if (!GDK::state) return;
+    uint32_t prog = g_TerrainVPShader;
+    glUseProgram(prog);
+    glUniformMatrix4fv(glGetUniformLocation(prog, "u_Proj"), 1, GL_FALSE, glm::value_ptr(GDK::state->projection));
+    glUniformMatrix4fv(glGetUniformLocation(prog, "u_View"), 1, GL_FALSE, glm::value_ptr(GDK::state->view));
+    glUniform1f(glGetUniformLocation(prog, "u_ScaleXZ"), t.scaleXZ);
+    glUniform1i(glGetUniformLocation(prog, "u_ChunksX"), t.chunksX);
+
+    // Light 1 drives the sun, slot 0 is the scene ambient (See GDK_Scene_Clear)
+    const GDK_Light& sun = GDK_Internal::lights[1];
+    glm::vec3 sunDir = sun.enabled ? sun.direction : glm::vec3(0.0f, -1.0f, 0.0f);
+    glm::vec3 sunCol = sun.enabled ? sun.color * sun.power : glm::vec3(1.0f);
+    glm::vec3 amb = glm::vec3(GDK_Internal::worldAmbient.r, GDK_Internal::worldAmbient.g, GDK_Internal::worldAmbient.b) * GDK_Internal::worldAmbient.a;
+    glUniform3f(glGetUniformLocation(prog, "u_LightDir"), sunDir.x, sunDir.y, sunDir.z);
+    glUniform3f(glGetUniformLocation(prog, "u_LightColor"), sunCol.x, sunCol.y, sunCol.z);
+    glUniform3f(glGetUniformLocation(prog, "u_Ambient"), amb.x, amb.y, amb.z);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, t.heightTex);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, t.textureID < g_Textures.size() ? g_Textures[t.textureID] : 0);
+
+    glBindVertexArray(g_TerrainGrid.vao);
+    glDrawElementsInstanced(GL_TRIANGLES, g_TerrainGrid.indexCount, GL_UNSIGNED_SHORT, 0, t.chunksX * t.chunksZ);
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+
+// --- DEFORMATION (Dirty-Region Uploads) ---
+enum GDK_TerrainOp { TERRAIN_OP_RAISE = 0, TERRAIN_OP_LOWER = 1, TERRAIN_OP_FLATTEN = 2, TERRAIN_OP_SMOOTH = 3, TERRAIN_OP_CRATER = 4 };
+
+// Pushes grid rect [x0..x1] x [z0..z1] (inclusive, already clamped) from t.heights to the GPU
+static void GDK_Internal_PushTerrainRegion(GDK_Internal_Terrain& t, int x0, int z0, int x1, int z1) {
+    const int w = t.width;
+
+    // Mode 1 & 2 Pulled: normals are derived in the shader, only heights move
+    if (t.pulled) {
+        glBindTexture(GL_TEXTURE_2D, t.heightTex);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, w);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x0, z0, x1 - x0 + 1, z1 - z0 + 1, GL_RED, GL_FLOAT, &t.heights[z0 * w + x0]);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return;
+    }
+
+    // Mode 0: recompile only the chunk lists that share a vertex with the rect
+    if (GDK::mode == GDK_MODE_LEGACY) {
+        int cx0 = std::max(0, (x0 - 1) / GDK_TERRAIN_CHUNK), cx1 = std::min(t.chunksX - 1, x1 / GDK_TERRAIN_CHUNK);
+        int cz0 = std::max(0, (z0 - 1) / GDK_TERRAIN_CHUNK), cz1 = std::min(t.chunksZ - 1, z1 / GDK_TERRAIN_CHUNK);
+        for (int cz = cz0; cz <= cz1; cz++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                GDK_Internal_CompileTerrainChunk(t, cx, cz, [&](int x, int z) { return GDK_Internal_MakeTerrainVertex(t, x, z); });
+            }
+        }
+        return;
+    }
+
+    // Mode 2: write through the persistent mapping once the GPU is done with the last draw
+    if (GDK::mode == GDK_MODE_AZDO && t.azdoPtr) {
+        if (t.fence) {
+            while (glClientWaitSync(t.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {}
+            glDeleteSync(t.fence);
+            t.fence = 0;
+        }
+        TerrainVertex* dst = (TerrainVertex*)t.azdoPtr;
+        for (int z = z0; z <= z1; z++)
+            for (int x = x0; x <= x1; x++) dst[z * w + x] = GDK_Internal_MakeTerrainVertex(t, x, z);
+        return;
+    }
+
+    // Mode 1: one glBufferSubData per dirty row segment
+    std::vector<TerrainVertex> row(x1 - x0 + 1);
+    glBindBuffer(GL_ARRAY_BUFFER, t.vbo);
+    for (int z = z0; z <= z1; z++) {
+        for (int x = x0; x <= x1; x++) row[x - x0] = GDK_Internal_MakeTerrainVertex(t, x, z);
+        glBufferSubData(GL_ARRAY_BUFFER, (size_t)(z * w + x0) * sizeof(TerrainVertex), row.size() * sizeof(TerrainVertex), row.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+
+// Shared tail of every terrain source (Heightmap image, GDK_GenerateTerrain): GPU build + registry
+static int GDK_Internal_RegisterTerrain(GDK_Internal_Terrain& terrain, std::vector<float>& heights) {
+    // Vertex pulling needs shaders - Legacy always gets the full mesh
+    if (!(g_TerrainPulling && GDK::mode != GDK_MODE_LEGACY && GDK_Internal_BuildTerrainHeightTex(terrain, heights))) {
+        GDK_Internal_BuildTerrainMesh(terrain, heights);
+    }
+    terrain.heights = std::move(heights);
+
+    g_Terrains.push_back(std::move(terrain));
+    return (int)g_Terrains.size() - 1;
+}
+
+GDK_BEGIN_DECLS
+
+GDK_API int GDK_LoadTerrain(const char* heightmapPath, const char* texturePath, float scaleXZ, float scaleY) {
+    auto t = std::chrono::high_resolution_clock::now();
+
+    int imgW, imgH, imgC;
+    stbi_set_flip_vertically_on_load(true); 
+    unsigned char* data = stbi_load(heightmapPath, &imgW, &imgH, &imgC, 1);
+    if (!data) return -1;
+    ApplyBoxBlur(data, imgW, imgH, 3); // Use a kernel size of 3
+    ApplyBoxBlur(data, imgW, imgH, 3); // Use a kernel size of 3
+    ApplyBoxBlur(data, imgW, imgH, 3); // Use a kernel size of 3
+
+    GDK_Internal_Terrain terrain = {};
+    terrain.width = imgW; terrain.height = imgH;
+    terrain.scaleXZ = scaleXZ; terrain.scaleY = scaleY;
+    terrain.textureID = GDK_LoadTexture(texturePath);
+
+    std::vector<float> rawHeights((size_t)imgW * imgH);
+    GDK::Jobs::ParallelFor(imgH, 64, [&](int z0, int z1) {
+        for (int i = z0 * imgW; i < z1 * imgW; i++) {
+            rawHeights[i] = ((float)data[i] / 255.0f) * 15.0f * scaleY;
+        }
+    });
+    stbi_image_free(data);
+    terrain.buildMs[TERRAIN_PHASE_DECODE] = GDK_Internal_TerrainLap(t);
+
+    return GDK_Internal_RegisterTerrain(terrain, rawHeights);
+}
+
+GDK_API float GDK_GetTerrainHeight(int terrainIdx, float worldX, float worldZ) {
+    if (terrainIdx < 0 || (size_t)terrainIdx >= g_Terrains.size()) return 0.0f;
+    auto& t = g_Terrains[terrainIdx];
+
+    float gridX = worldX / t.scaleXZ;
+    float gridZ = worldZ / t.scaleXZ;
+
+    int x0 = (int)std::floor(gridX);
+    int z0 = (int)std::floor(gridZ);
+    
+    if (x0 < 0 || x0 >= t.width - 1 || z0 < 0 || z0 >= t.height - 1) return 0.0f;
+
+    float fracX = gridX - (float)x0;
+    float fracZ = gridZ - (float)z0;
+
+    // Data is already pre-scaled (and kept current by GDK_Terrain_ModifyRegion)
+    const float* hg = t.heights.data();
+    float h00 = hg[z0 * t.width + x0];
+    float h10 = hg[z0 * t.width + x0 + 1];
+    float h01 = hg[(z0 + 1) * t.width + x0];
+    float h11 = hg[(z0 + 1) * t.width + x0 + 1];
+
+    float top = h00 + (h10 - h00) * fracX;
+    float bottom = h01 + (h11 - h01) * fracX;
+    return top + (bottom - top) * fracZ;
+}
+
+// Edits the height grid inside the w x h sample rect at x,z (Craters, digging, flattening).
+// op: GDK_TerrainOp. amount: height delta (Raise/Lower/Crater), target height (Flatten) or 0..1 strength (Smooth).
+// Only the rect + a 1-sample normal border is rebuilt and sent to the GPU.
+GDK_API void GDK_Terrain_ModifyRegion(int terrainIdx, int x, int z, int w, int h, int op, float amount) {
+    if (terrainIdx < 0 || (size_t)terrainIdx >= g_Terrains.size()) return;
+    auto& t = g_Terrains[terrainIdx];
+    if (t.heights.empty() || w <= 0 || h <= 0) return;
+
+    int x0 = std::max(0, x), z0 = std::max(0, z);
+    int x1 = std::min(t.width - 1, x + w - 1), z1 = std::min(t.height - 1, z + h - 1);
+    if (x1 < x0 || z1 < z0) return;
+
+    // Soft elliptical brush centred in the (unclamped) rect
+    float cx = x + (w - 1) * 0.5f, cz = z + (h - 1) * 0.5f;
+    float rx = std::max(0.5f, w * 0.5f), rz = std::max(0.5f, h * 0.5f);
+
+    // Smoothing reads neighbours - work from a snapshot of the rect + 1
+    int sx0 = std::max(0, x0 - 1), sz0 = std::max(0, z0 - 1);
+    int sx1 = std::min(t.width - 1, x1 + 1), sz1 = std::min(t.height - 1, z1 + 1);
+    int sw = sx1 - sx0 + 1;
+    std::vector<float> snap;
+    if (op == TERRAIN_OP_SMOOTH) {
+        snap.resize((size_t)sw * (sz1 - sz0 + 1));
+        for (int zz = sz0; zz <= sz1; zz++)
+            memcpy(&snap[(zz - sz0) * sw], &t.heights[zz * t.width + sx0], sw * sizeof(float));
+    }
+
+    for (int zz = z0; zz <= z1; zz++) {
+        for (int xx = x0; xx <= x1; xx++) {
+            float dx = (xx - cx) / rx, dz = (zz - cz) / rz;
+            float r = std::sqrt(dx * dx + dz * dz);
+            if (r >= 1.0f) continue;
+            float falloff = 0.5f * (1.0f + std::cos(r * glm::pi<float>()));
+            float& hv = t.heights[zz * t.width + xx];
+
+            switch (op) {
+                case TERRAIN_OP_RAISE:   hv += amount * falloff; break;
+                case TERRAIN_OP_LOWER:   hv -= amount * falloff; break;
+                case TERRAIN_OP_FLATTEN: hv += (amount - hv) * falloff; break;
+                case TERRAIN_OP_SMOOTH: {
+                    float sum = 0.0f; int count = 0;
+                    for (int kz = std::max(sz0, zz - 1); kz <= std::min(sz1, zz + 1); kz++)
+                        for (int kx = std::max(sx0, xx - 1); kx <= std::min(sx1, xx + 1); kx++) { sum += snap[(kz - sz0) * sw + (kx - sx0)]; count++; }
+                    hv += (sum / count - hv) * falloff * glm::clamp(amount, 0.0f, 1.0f);
+                } break;
+                case TERRAIN_OP_CRATER: {
+                    // Bowl out to 75% of the radius, then a raised lip
+                    float profile = (r < 0.75f) ? -(1.0f - (r / 0.75f) * (r / 0.75f))
+                                                : 0.3f * std::sin((r - 0.75f) / 0.25f * glm::pi<float>());
+                    hv += amount * profile;
+                } break;
+                default: return;
+            }
+        }
+    }
+
+    GDK_Internal_PushTerrainRegion(t, sx0, sz0, sx1, sz1);
+}
+
+// 1 = Terrains loaded from now on keep only a height texture (Mode 1 & 2). Ignored in Legacy.
+GDK_API void GDK_Terrain_SetVertexPulling(int enable) {
+    g_TerrainPulling = (enable != 0);
+}
+
+// Milliseconds spent in one load phase (GDK_TerrainPhase), -1 for a bad index
+GDK_API float GDK_Terrain_GetBuildTime(int terrainIdx, int phase) {
+    if (terrainIdx < 0 || (size_t)terrainIdx >= g_Terrains.size()) return -1.0f;
+    if (phase < 0 || phase >= TERRAIN_PHASE_COUNT) return -1.0f;
+    return g_Terrains[terrainIdx].buildMs[phase];
+}
+
+GDK_API void GDK_RenderTerrain(int terrainIdx) {
+    if (terrainIdx < 0 || (size_t)terrainIdx >= g_Terrains.size()) return;
+    auto& t = g_Terrains[terrainIdx];
+
+    if (t.pulled) { GDK_Internal_RenderTerrainVP(t); return; }
+
+    // 1 & 2. Texture Application (Shared with the tile streamer)
+    GDK_Internal_BindTerrainTexture(t.textureID);
+
+    // 3. Drawing Branch
+    if (GDK::mode == GDK_MODE_LEGACY) {
+        for (uint32_t list : t.chunkLists) glCallList(list);
+    } else {
+        glBindVertexArray(t.vao);
+        glDrawElements(GL_TRIANGLES, t.indexCount, GL_UNSIGNED_INT, 0);
+
+        // Fence the draw so edits know when azdoPtr is safe to write
+        if (GDK::mode == GDK_MODE_AZDO) {
+            if (t.fence) glDeleteSync(t.fence);
+            t.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+    }
+}
+
+
+GDK_END_DECLS
+
+#endif 
@@ -0,0 +1,296 @@
+#ifndef GDK_TERRAIN_GEN_H
+#define GDK_TERRAIN_GEN_H
+
+// --- PROCEDURAL TERRAIN ---
+// Builds the height grid directly (no PNG round trip) and feeds the same
+// GDK_Internal_RegisterTerrain path as GDK_LoadTerrain, so pulling/legacy/AZDO all just work.
+// Noise: 2D gradient noise, 8 lanes at a time under AVX2 (scalar fallback runs the same math).
+// Erosion: droplet hydraulic erosion, tiles run in a 2x2 checkerboard so no two live tiles touch.
+
+struct GDK_TerrainGenParams {
+    float scaleXZ, scaleY;  // Same meaning as GDK_LoadTerrain
+    int octaves;            // fBm layers
+    float frequency;        // Base features across the whole map
+    float lacunarity, gain; // Per-octave frequency / amplitude multipliers
+    float ridged;           // 0 = rolling fBm, 1 = sharp ridged mountains
+    int erosionDroplets;    // 0 = skip erosion
+    float erosionRate, depositRate;
+};
+
+#define GDK_TERRAIN_GEN_TILE 128 // Samples per tile edge (Noise + erosion work unit)
+
+static inline uint32_t GDK_Internal_NoiseHash(int x, int y, uint32_t seed) {
+    uint32_t h = ((uint32_t)x * 0x8da6b343u) ^ ((uint32_t)y * 0xd8163841u) ^ (seed * 0xcb1ab31fu);
+    h ^= h >> 13; h *= 0x5bd1e995u; h ^= h >> 15;
+    return h;
+}
+
+// 8 unit gradients, picked by the low 3 hash bits
+static const float g_NoiseGradX[8] = { 1.0f, -1.0f, 0.0f,  0.0f, 0.70710678f, -0.70710678f,  0.70710678f, -0.70710678f };
+static const float g_NoiseGradY[8] = { 0.0f,  0.0f, 1.0f, -1.0f, 0.70710678f,  0.70710678f, -0.70710678f, -0.70710678f };
+
+static inline float GDK_Internal_GradNoise(float x, float y, uint32_t seed) {
+    float fx0 = std::floor(x), fy0 = std::floor(y);
+    int x0 = (int)fx0, y0 = (int)fy0;
+    float xf = x - fx0, yf = y - fy0;
+    float u = xf * xf * xf * (xf * (xf * 6.0f - 15.0f) + 10.0f);
+    float v = yf * yf * yf * (yf * (yf * 6.0f - 15.0f) + 10.0f);
+
+    auto Corner = [&](int i, int j) {
+        uint32_t h = GDK_Internal_NoiseHash(x0 + i, y0 + j, seed) & 7;
+        return g_NoiseGradX[h] * (xf - (float)i) + g_NoiseGradY[h] * (yf - (float)j);
+    };
+    float n00 = Corner(0, 0), n10 = Corner(1, 0), n01 = Corner(0, 1), n11 = Corner(1, 1);
+    float nx0 = n00 + (n10 - n00) * u;
+    float nx1 = n01 + (n11 - n01) * u;
+    return (nx0 + (nx1 - nx0) * v) * 1.41421356f; // ~[-1, 1]
+}
+
+#ifdef GDK_SIMD_AVX2
+static inline __m256i GDK_Internal_NoiseHash8(__m256i x, __m256i y, uint32_t seed) {
+    __m256i h = _mm256_xor_si256(_mm256_mullo_epi32(x, _mm256_set1_epi32((int)0x8da6b343u)),
+                                 _mm256_mullo_epi32(y, _mm256_set1_epi32((int)0xd8163841u)));
+    h = _mm256_xor_si256(h, _mm256_set1_epi32((int)(seed * 0xcb1ab31fu)));
+    h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 13));
+    h = _mm256_mullo_epi32(h, _mm256_set1_epi32((int)0x5bd1e995u));
+    h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 15));
+    return h;
+}
+
+static inline __m256 GDK_Internal_GradNoise8(__m256 x, __m256 y, uint32_t seed) {
+    const __m256 gx = _mm256_loadu_ps(g_NoiseGradX), gy = _mm256_loadu_ps(g_NoiseGradY);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i seven = _mm256_set1_epi32(7), ione = _mm256_set1_epi32(1);
+
+    __m256 fx0 = _mm256_floor_ps(x), fy0 = _mm256_floor_ps(y);
+    __m256i x0 = _mm256_cvtps_epi32(fx0), y0 = _mm256_cvtps_epi32(fy0);
+    __m256 xf = _mm256_sub_ps(x, fx0), yf = _mm256_sub_ps(y, fy0);
+
+    auto Fade = [](__m256 t) {
+        __m256 k = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f));
+        return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), k);
+    };
+    __m256 u = Fade(xf), v = Fade(yf);
+
+    auto Corner = [&](__m256i cx, __m256i cy, __m256 dx, __m256 dy) {
+        __m256i h = _mm256_and_si256(GDK_Internal_NoiseHash8(cx, cy, seed), seven);
+        return _mm256_add_ps(_mm256_mul_ps(_mm256_permutevar8x32_ps(gx, h), dx), _mm256_mul_ps(_mm256_permutevar8x32_ps(gy, h), dy));
+    };
+    __m256i x1 = _mm256_add_epi32(x0, ione), y1 = _mm256_add_epi32(y0, ione);
+    __m256 xf1 = _mm256_sub_ps(xf, one), yf1 = _mm256_sub_ps(yf, one);
+    __m256 n00 = Corner(x0, y0, xf, yf), n10 = Corner(x1, y0, xf1, yf);
+    __m256 n01 = Corner(x0, y1, xf, yf1), n11 = Corner(x1, y1, xf1, yf1);
+
+    __m256 nx0 = _mm256_add_ps(n00, _mm256_mul_ps(_mm256_sub_ps(n10, n00), u));
+    __m256 nx1 = _mm256_add_ps(n01, _mm256_mul_ps(_mm256_sub_ps(n11, n01), u));
+    return _mm256_mul_ps(_mm256_add_ps(nx0, _mm256_mul_ps(_mm256_sub_ps(nx1, nx0), v)), _mm256_set1_ps(1.41421356f));
+}
+#endif
+
+// fBm/ridged blend for 'count' samples of row 'z' starting at column 'x0'. Output is unnormalised.
+static void GDK_Internal_TerrainNoiseRow(const GDK_TerrainGenParams& p, uint32_t seed, int size, int z, int x0, int count, float* out) {
+    const float inv = 1.0f / (float)size;
+    float fz = (float)z * inv;
+    int x = 0;
+
+#ifdef GDK_SIMD_AVX2
+    const __m256 lane = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (; x + 8 <= count; x += 8) {
+        __m256 px = _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps((float)(x0 + x)), lane), _mm256_set1_ps(inv));
+        __m256 fbm = _mm256_setzero_ps(), ridge = _mm256_setzero_ps();
+        float freq = p.frequency, amp = 1.0f;
+        for (int o = 0; o < p.octaves; o++) {
+            __m256 n = GDK_Internal_GradNoise8(_mm256_mul_ps(px, _mm256_set1_ps(freq)), _mm256_set1_ps(fz * freq), seed + o);
+            __m256 r = _mm256_sub_ps(one, _mm256_andnot_ps(signMask, n)); // 1 - |n|
+            fbm = _mm256_add_ps(fbm, _mm256_mul_ps(n, _mm256_set1_ps(amp)));
+            ridge = _mm256_add_ps(ridge, _mm256_mul_ps(_mm256_mul_ps(r, r), _mm256_set1_ps(amp)));
+            freq *= p.lacunarity; amp *= p.gain;
+        }
+        // fbm is ~[-1,1] -> [0,1]; ridged is already positive
+        fbm = _mm256_mul_ps(_mm256_add_ps(fbm, one), _mm256_set1_ps(0.5f));
+        __m256 hgt = _mm256_add_ps(fbm, _mm256_mul_ps(_mm256_sub_ps(ridge, fbm), _mm256_set1_ps(p.ridged)));
+        _mm256_storeu_ps(out + x, hgt);
+    }
+#endif
+
+    for (; x < count; x++) {
+        float px = (float)(x0 + x) * inv;
+        float fbm = 0.0f, ridge = 0.0f, freq = p.frequency, amp = 1.0f;
+        for (int o = 0; o < p.octaves; o++) {
+            float n = GDK_Internal_GradNoise(px * freq, fz * freq, seed + o);
+            float r = 1.0f - std::fabs(n);
+            fbm += n * amp;
+            ridge += r * r * amp;
+            freq *= p.lacunarity; amp *= p.gain;
+        }
+        fbm = (fbm + 1.0f) * 0.5f;
+        out[x] = fbm + (ridge - fbm) * p.ridged;
+    }
+}
+
+// Droplet erosion confined to one tile's bounds (heights are normalised 0..1 here)
+static void GDK_Internal_ErodeTile(std::vector<float>& map, int size, int tx0, int tz0, int tx1, int tz1, int droplets, uint32_t seed, const GDK_TerrainGenParams& p) {
+    const float inertia = 0.05f, capacityK = 4.0f, minCapacity = 0.01f, gravity = 4.0f, evaporate = 0.01f;
+    const int maxLife = 30;
+    uint32_t rng = seed | 1u;
+    auto Rand = [&]() { rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return (rng & 0xFFFFFF) / 16777216.0f; };
+
+    // Bilinear height + gradient at a point
+    auto Sample = [&](float x, float z, float& gx, float& gz) {
+        int ix = (int)x, iz = (int)z;
+        float fx = x - ix, fz = z - iz;
+        float h00 = map[iz * size + ix], h10 = map[iz * size + ix + 1];
+        float h01 = map[(iz + 1) * size + ix], h11 = map[(iz + 1) * size + ix + 1];
+        gx = (h10 - h00) * (1 - fz) + (h11 - h01) * fz;
+        gz = (h01 - h00) * (1 - fx) + (h11 - h10) * fx;
+        return h00 * (1 - fx) * (1 - fz) + h10 * fx * (1 - fz) + h01 * (1 - fx) * fz + h11 * fx * fz;
+    };
+    auto Splat = [&](float x, float z, float amount) {
+        int ix = (int)x, iz = (int)z;
+        float fx = x - ix, fz = z - iz;
+        map[iz * size + ix]           += amount * (1 - fx) * (1 - fz);
+        map[iz * size + ix + 1]       += amount * fx * (1 - fz);
+        map[(iz + 1) * size + ix]     += amount * (1 - fx) * fz;
+        map[(iz + 1) * size + ix + 1] += amount * fx * fz;
+    };
+
+    // Droplets never leave [tx0, tx1 - 1] so the 2x2 corner splat stays inside the tile
+    float minX = (float)tx0, maxX = (float)(tx1 - 1) - 0.001f;
+    float minZ = (float)tz0, maxZ = (float)(tz1 - 1) - 0.001f;
+    if (maxX <= minX || maxZ <= minZ) return;
+
+    for (int d = 0; d < droplets; d++) {
+        float x = minX + Rand() * (maxX - minX), z = minZ + Rand() * (maxZ - minZ);
+        float dx = 0, dz = 0, speed = 1, water = 1, sediment = 0;
+
+        for (int life = 0; life < maxLife; life++) {
+            float gx, gz;
+            float h = Sample(x, z, gx, gz);
+            dx = dx * inertia - gx * (1 - inertia);
+            dz = dz * inertia - gz * (1 - inertia);
+            float len = std::sqrt(dx * dx + dz * dz);
+            if (len < 1e-6f) break;
+            dx /= len; dz /= len;
+
+            float nx = x + dx, nz = z + dz;
+            if (nx < minX || nx > maxX || nz < minZ || nz > maxZ) break;
+
+            float ngx, ngz;
+            float dh = Sample(nx, nz, ngx, ngz) - h;
+            float capacity = std::max(-dh * speed * water * capacityK, minCapacity);
+
+            if (sediment > capacity || dh > 0) {
+                float deposit = (dh > 0) ? std::min(dh, sediment) : (sediment - capacity) * p.depositRate;
+                sediment -= deposit;
+                Splat(x, z, deposit);
+            } else {
+                float erode = std::min((capacity - sediment) * p.erosionRate, -dh);
+                Splat(x, z, -erode);
+                sediment += erode;
+            }
+
+            speed = std::sqrt(std::max(0.0f, speed * speed - dh * gravity));
+            water *= (1 - evaporate);
+            x = nx; z = nz;
+        }
+    }
+}
+
+GDK_BEGIN_DECLS
+
+// Fills 'out' with sensible defaults (Rolling hills with some ridges, light erosion)
+GDK_API void GDK_Terrain_DefaultGenParams(GDK_TerrainGenParams* out) {
+    if (!out) return;
+    out->scaleXZ = 1.0f; out->scaleY = 1.0f;
+    out->octaves = 6;
+    out->frequency = 4.0f;
+    out->lacunarity = 2.0f; out->gain = 0.5f;
+    out->ridged = 0.35f;
+    out->erosionDroplets = 0;
+    out->erosionRate = 0.3f; out->depositRate = 0.3f;
+}
+
+// Generates a size x size terrain straight into the mesh path. params may be NULL (defaults).
+GDK_API int GDK_GenerateTerrain(int seed, int size, const GDK_TerrainGenParams* params, const char* texturePath) {
+    if (size < 2) return -1;
+    GDK_TerrainGenParams p;
+    if (params) p = *params; else GDK_Terrain_DefaultGenParams(&p);
+    p.octaves = std::max(1, std::min(p.octaves, 16));
+
+    auto t = std::chrono::high_resolution_clock::now();
+    const int T = GDK_TERRAIN_GEN_TILE;
+    const int tilesX = (size + T - 1) / T;
+    const int tileCount = tilesX * tilesX;
+    std::vector<float> map((size_t)size * size);
+
+    // 1. Noise - one job per tile
+    GDK::Jobs::ParallelFor(tileCount, 1, [&](int t0, int t1) {
+        for (int ti = t0; ti < t1; ti++) {
+            int x0 = (ti % tilesX) * T, z0 = (ti / tilesX) * T;
+            int cw = std::min(T, size - x0), ch = std::min(T, size - z0);
+            for (int z = z0; z < z0 + ch; z++) {
+                GDK_Internal_TerrainNoiseRow(p, (uint32_t)seed, size, z, x0, cw, &map[(size_t)z * size + x0]);
+            }
+        }
+    });
+
+    // 2. Normalise to 0..1 (Per-band min/max, then merged)
+    std::vector<float> bandMin(size, 1e30f), bandMax(size, -1e30f);
+    GDK::Jobs::ParallelFor(size, 64, [&](int z0, int z1) {
+        for (int z = z0; z < z1; z++) {
+            const float* row = &map[(size_t)z * size];
+            float lo = row[0], hi = row[0];
+            for (int x = 1; x < size; x++) { lo = std::min(lo, row[x]); hi = std::max(hi, row[x]); }
+            bandMin[z] = lo; bandMax[z] = hi;
+        }
+    });
+    float lo = *std::min_element(bandMin.begin(), bandMin.end());
+    float hi = *std::max_element(bandMax.begin(), bandMax.end());
+    float range = (hi - lo) > 1e-6f ? (hi - lo) : 1.0f;
+    GDK::Jobs::ParallelFor(size, 64, [&](int z0, int z1) {
+        for (size_t i = (size_t)z0 * size; i < (size_t)z1 * size; i++) map[i] = (map[i] - lo) / range;
+    });
+    float noiseMs = GDK_Internal_TerrainLap(t);
+
+    // 3. Hydraulic erosion - 4 checkerboard passes, tiles in a pass never share an edge
+    if (p.erosionDroplets > 0) {
+        int perTile = std::max(1, p.erosionDroplets / tileCount);
+        for (int pass = 0; pass < 4; pass++) {
+            int px = pass & 1, pz = pass >> 1;
+            std::vector<int> live;
+            for (int ti = 0; ti < tileCount; ti++) {
+                if ((ti % tilesX) % 2 == px && (ti / tilesX) % 2 == pz) live.push_back(ti);
+            }
+            GDK::Jobs::ParallelFor((int)live.size(), 1, [&](int a, int b) {
+                for (int k = a; k < b; k++) {
+                    int ti = live[k];
+                    int x0 = (ti % tilesX) * T, z0 = (ti / tilesX) * T;
+                    GDK_Internal_ErodeTile(map, size, x0, z0, std::min(x0 + T, size), std::min(z0 + T, size),
+                                           perTile, GDK_Internal_NoiseHash(ti, pass, (uint32_t)seed), p);
+                }
+            });
+        }
+    }
+    float erodeMs = GDK_Internal_TerrainLap(t);
+
+    // 4. To world heights (Same 0..15 range as GDK_LoadTerrain) and into the shared build path
+    float worldScale = 15.0f * p.scaleY;
+    GDK::Jobs::ParallelFor(size, 64, [&](int z0, int z1) {
+        for (size_t i = (size_t)z0 * size; i < (size_t)z1 * size; i++) map[i] = glm::clamp(map[i], 0.0f, 1.0f) * worldScale;
+    });
+
+    GDK_Internal_Terrain terrain = {};
+    terrain.width = size; terrain.height = size;
+    terrain.scaleXZ = p.scaleXZ; terrain.scaleY = p.scaleY;
+    terrain.textureID = GDK_LoadTexture(texturePath);
+    terrain.buildMs[TERRAIN_PHASE_DECODE] = noiseMs + erodeMs + GDK_Internal_TerrainLap(t);
+
+    printf("[TERRAIN] Generated %dx%d (seed %d): noise %.2fms | erosion %.2fms\n", size, size, seed, noiseMs, erodeMs);
+    return GDK_Internal_RegisterTerrain(terrain, map);
+}
+
+GDK_END_DECLS
+
+#endif // GDK_TERRAIN_GEN_H
@@ -0,0 +1,410 @@
+#ifndef GDK_TERRAIN_STREAM_H
+#define GDK_TERRAIN_STREAM_H
+
+// --- OUT-OF-CORE TERRAIN (Tiled .gdkt + Paging) ---
+// File Layout: [Header][Tile 0][Tile 1]... Tiles are row-major (tz * tilesX + tx).
+// Each tile holds (tileSize + 3)^2 uint16 heights: its (tileSize + 1)^2 grid plus a 1-sample
+// apron, so a worker can bake edge normals without ever touching a neighbouring tile.
+// The file is memory mapped - only the tiles around the camera are ever paged in.
+
+#define GDK_TERRAIN_TILE_VERSION 1
+
+#pragma pack(push, 1)
+struct GDK_TerrainTileHeader {
+    char magic[4];               // "GDKT"
+    uint32_t version;            // GDK_TERRAIN_TILE_VERSION
+    uint32_t tileSize;           // Quads per tile edge
+    uint32_t tilesX, tilesZ;
+    uint32_t samplesX, samplesZ; // Source heightmap size (UVs span the whole world)
+};
+#pragma pack(pop)
+
+enum GDK_TileState { GDK_TILE_EMPTY = 0, GDK_TILE_BUILDING = 1, GDK_TILE_READY = 2, GDK_TILE_RESIDENT = 3 };
+
+struct GDK_Internal_TerrainTile {
+    std::atomic<int> state{ GDK_TILE_EMPTY };
+    std::vector<TerrainVertex> verts; // Worker output, dropped once uploaded
+    uint32_t displayList = 0;         // Legacy (Mode 0)
+    uint32_t vao = 0, vbo = 0;        // Standard/AZDO (Mode 1 & 2)
+};
+
+struct GDK_Internal_TerrainStream {
+    GDK::Internal::MappedFile file;
+    const GDK_TerrainTileHeader* header = nullptr;
+    const uint16_t* samples = nullptr;
+
+    uint32_t textureID = 0;
+    float scaleXZ = 1.0f, scaleY = 1.0f;
+    int ringRadius = 2;
+    size_t uploadBudget = 4 * 1024 * 1024; // Bytes of vertex data pushed to GL per frame
+
+    // Every tile shares one topology
+    std::vector<uint32_t> indices;
+    uint32_t ebo = 0;
+
+    std::map<int, GDK_Internal_TerrainTile> tiles; // Key: tz * tilesX + tx
+    std::atomic<int> inFlight{ 0 };
+    int residentCount = 0;
+};
+
+// Heap allocated so worker jobs can hold a stable pointer
+static std::vector<GDK_Internal_TerrainStream*> g_TerrainStreams;
+
+static inline const uint16_t* GDK_Internal_TileSamples(const GDK_Internal_TerrainStream& s, int tx, int tz) {
+    size_t apron = s.header->tileSize + 3;
+    return s.samples + ((size_t)tz * s.header->tilesX + tx) * apron * apron;
+}
+
+// WORKER THREAD: Bakes positions + normals for one tile straight from the mapped file
+static void GDK_Internal_BuildStreamTile(GDK_Internal_TerrainStream* s, GDK_Internal_TerrainTile* tile, int tx, int tz) {
+    const GDK_TerrainTileHeader& h = *s->header;
+    const int n = h.tileSize + 1;
+    const int apron = h.tileSize + 3;
+    const uint16_t* src = GDK_Internal_TileSamples(*s, tx, tz);
+
+    // Same 0..15 world range as GDK_LoadTerrain, just with 16-bit precision
+    const float hScale = (15.0f * s->scaleY) / 65535.0f;
+    auto H = [&](int x, int z) { return (float)src[(z + 1) * apron + (x + 1)] * hScale; };
+
+    tile->verts.resize((size_t)n * n);
+    for (int z = 0; z < n; z++) {
+        for (int x = 0; x < n; x++) {
+            TerrainVertex& v = tile->verts[z * n + x];
+            int gx = tx * h.tileSize + x;
+            int gz = tz * h.tileSize + z;
+
+            v.x = (float)gx * s->scaleXZ;
+            v.y = H(x, z);
+            v.z = (float)gz * s->scaleXZ;
+            v.u = (float)gx / (h.samplesX - 1);
+            v.v = (float)gz / (h.samplesZ - 1);
+
+            // Apron replaces the edge clamp in CalculateNormal
+            glm::vec3 nrm = glm::normalize(glm::vec3(H(x - 1, z) - H(x + 1, z), 2.0f * s->scaleXZ, H(x, z - 1) - H(x, z + 1)));
+            v.nx = nrm.x; v.ny = nrm.y; v.nz = nrm.z;
+        }
+    }
+}
+
+// MAIN THREAD: Hands a finished tile to GL
+static size_t GDK_Internal_UploadStreamTile(GDK_Internal_TerrainStream& s, GDK_Internal_TerrainTile& t) {
+    size_t bytes = t.verts.size() * sizeof(TerrainVertex);
+
+    if (GDK::mode == GDK_MODE_LEGACY) {
+        t.displayList = glGenLists(1);
+        glNewList(t.displayList, GL_COMPILE);
+        glBegin(GL_TRIANGLES);
+        for (auto idx : s.indices) {
+            const TerrainVertex& v = t.verts[idx];
+            glNormal3f(v.nx, v.ny, v.nz);
+            glTexCoord2f(v.u, v.v);
+            glVertex3f(v.x, v.y, v.z);
+        }
+        glEnd();
+        glEndList();
+    }
+    else {
+        glGenVertexArrays(1, &t.vao);
+        glGenBuffers(1, &t.vbo);
+        glBindVertexArray(t.vao);
+
+        glBindBuffer(GL_ARRAY_BUFFER, t.vbo);
+        if (GDK::mode == GDK_MODE_AZDO) {
+            // Immutable storage - tiles are never rewritten, only dropped
+            glBufferStorage(GL_ARRAY_BUFFER, bytes, t.verts.data(), 0);
+        } else {
+            glBufferData(GL_ARRAY_BUFFER, bytes, t.verts.data(), GL_STATIC_DRAW);
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s.ebo);
+
+        glEnableVertexAttribArray(0); // Pos
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, x));
+        glEnableVertexAttribArray(1); // Normal
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, nx));
+        glEnableVertexAttribArray(2); // Tex
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)offsetof(TerrainVertex, u));
+        glBindVertexArray(0);
+    }
+
+    // CPU copy is no longer needed
+    std::vector<TerrainVertex>().swap(t.verts);
+    t.state = GDK_TILE_RESIDENT;
+    s.residentCount++;
+    return bytes;
+}
+
+static void GDK_Internal_FreeStreamTile(GDK_Internal_TerrainStream& s, GDK_Internal_TerrainTile& t) {
+    if (t.state == GDK_TILE_RESIDENT) {
+        if (t.displayList) glDeleteLists(t.displayList, 1);
+        if (t.vbo) glDeleteBuffers(1, &t.vbo);
+        if (t.vao) glDeleteVertexArrays(1, &t.vao);
+        s.residentCount--;
+    }
+    t.displayList = 0; t.vao = 0; t.vbo = 0;
+}
+
+// ApplyBoxBlur for 16-bit samples (Same window, same edge handling) so baked tiles match GDK_LoadTerrain
+static void GDK_Internal_BoxBlur16(uint16_t* data, int width, int height, int kernelSize) {
+    std::vector<uint16_t> temp((size_t)width * height);
+    int halfKernel = kernelSize / 2;
+    GDK::Jobs::ParallelFor(height, 64, [&](int z0, int z1) {
+        for (int z = z0; z < z1; z++) {
+            for (int x = 0; x < width; x++) {
+                uint32_t sum = 0, count = 0;
+                for (int sz = std::max(0, z - halfKernel); sz <= std::min(height - 1, z + halfKernel); sz++) {
+                    for (int sx = std::max(0, x - halfKernel); sx <= std::min(width - 1, x + halfKernel); sx++) {
+                        sum += data[sz * width + sx];
+                        count++;
+                    }
+                }
+                temp[(size_t)z * width + x] = (uint16_t)(sum / count);
+            }
+        }
+    });
+    memcpy(data, temp.data(), temp.size() * sizeof(uint16_t));
+}
+
+GDK_BEGIN_DECLS
+
+// OFFLINE: Converts a heightmap image (8 or 16-bit) into a tiled .gdkt file. Returns tile count or -1.
+GDK_API int GDK_Terrain_BakeTiles(const char* heightmapPath, const char* outPath, int tileSize) {
+    if (tileSize < 1) return -1;
+
+    int imgW, imgH, imgC;
+    stbi_set_flip_vertically_on_load(true); // Match GDK_LoadTerrain orientation
+    uint16_t* data = stbi_load_16(heightmapPath, &imgW, &imgH, &imgC, 1);
+    if (!data) return -1;
+    if (imgW < 2 || imgH < 2) { stbi_image_free(data); return -1; }
+    for (int pass = 0; pass < 3; pass++) GDK_Internal_BoxBlur16(data, imgW, imgH, 3); // Same smoothing as GDK_LoadTerrain
+
+    GDK_TerrainTileHeader h = {};
+    memcpy(h.magic, "GDKT", 4);
+    h.version = GDK_TERRAIN_TILE_VERSION;
+    h.tileSize = (uint32_t)tileSize;
+    h.tilesX = (uint32_t)((imgW - 1 + tileSize - 1) / tileSize);
+    h.tilesZ = (uint32_t)((imgH - 1 + tileSize - 1) / tileSize);
+    h.samplesX = (uint32_t)imgW;
+    h.samplesZ = (uint32_t)imgH;
+
+    std::ofstream out(outPath, std::ios::binary);
+    if (!out) { stbi_image_free(data); return -1; }
+    out.write((const char*)&h, sizeof(h));
+
+    // Clamp-to-edge sampling gives the outer apron the same behaviour as CalculateNormal
+    auto Sample = [&](int x, int z) {
+        x = std::max(0, std::min(imgW - 1, x));
+        z = std::max(0, std::min(imgH - 1, z));
+        return data[z * imgW + x];
+    };
+
+    const int apron = tileSize + 3;
+    std::vector<uint16_t> tile((size_t)apron * apron);
+    for (uint32_t tz = 0; tz < h.tilesZ; tz++) {
+        for (uint32_t tx = 0; tx < h.tilesX; tx++) {
+            for (int z = 0; z < apron; z++) {
+                for (int x = 0; x < apron; x++) {
+                    tile[z * apron + x] = Sample((int)tx * tileSize + x - 1, (int)tz * tileSize + z - 1);
+                }
+            }
+            out.write((const char*)tile.data(), tile.size() * sizeof(uint16_t));
+        }
+    }
+    stbi_image_free(data);
+
+    printf("[TERRAIN] Baked %s -> %s (%ux%u tiles of %d)\n", heightmapPath, outPath, h.tilesX, h.tilesZ, tileSize);
+    return (int)(h.tilesX * h.tilesZ);
+}
+
+GDK_API int GDK_Terrain_StreamOpen(const char* tilePath, const char* texturePath, float scaleXZ, float scaleY, int ringRadius) {
+    GDK_Internal_TerrainStream* s = new GDK_Internal_TerrainStream();
+    if (!s->file.Open(tilePath) || s->file.size < sizeof(GDK_TerrainTileHeader)) {
+        delete s;
+        return -1;
+    }
+
+    const GDK_TerrainTileHeader* h = (const GDK_TerrainTileHeader*)s->file.data;
+    size_t apron = (size_t)h->tileSize + 3;
+    size_t expected = sizeof(GDK_TerrainTileHeader) + (size_t)h->tilesX * h->tilesZ * apron * apron * sizeof(uint16_t);
+    if (memcmp(h->magic, "GDKT", 4) != 0 || h->version != GDK_TERRAIN_TILE_VERSION || h->tileSize == 0 || s->file.size < expected) {
+        printf("[TERRAIN ERR] Not a valid tile file: %s\n", tilePath);
+        s->file.Close();
+        delete s;
+        return -1;
+    }
+
+    s->header = h;
+    s->samples = (const uint16_t*)(s->file.data + sizeof(GDK_TerrainTileHeader));
+    s->scaleXZ = scaleXZ; s->scaleY = scaleY;
+    s->ringRadius = ringRadius < 0 ? 0 : ringRadius;
+    s->textureID = GDK_LoadTexture(texturePath);
+
+    // Shared tile topology
+    int n = h->tileSize + 1;
+    s->indices.reserve((size_t)h->tileSize * h->tileSize * 6);
+    for (int z = 0; z < n - 1; z++) {
+        for (int x = 0; x < n - 1; x++) {
+            uint32_t v1 = z * n + x;
+            uint32_t v2 = z * n + (x + 1);
+            uint32_t v3 = (z + 1) * n + x;
+            uint32_t v4 = (z + 1) * n + (x + 1);
+            s->indices.insert(s->indices.end(), { v1, v3, v4, v1, v4, v2 });
+        }
+    }
+    if (GDK::mode != GDK_MODE_LEGACY) {
+        glGenBuffers(1, &s->ebo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s->ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, s->indices.size() * sizeof(uint32_t), s->indices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    // Slot reuse
+    for (int i = 0; i < (int)g_TerrainStreams.size(); ++i) {
+        if (!g_TerrainStreams[i]) { g_TerrainStreams[i] = s; return i; }
+    }
+    g_TerrainStreams.push_back(s);
+    return (int)g_TerrainStreams.size() - 1;
+}
+
+// Bytes of vertex data allowed to reach GL per frame (Keeps streaming hitch-free)
+GDK_API void GDK_Terrain_StreamBudget(int streamIdx, int kilobytes) {
+    if (streamIdx < 0 || (size_t)streamIdx >= g_TerrainStreams.size() || !g_TerrainStreams[streamIdx]) return;
+    g_TerrainStreams[streamIdx]->uploadBudget = (size_t)std::max(1, kilobytes) * 1024;
+}
+
+// Call once per frame (after GDK_LookAt): requests, evicts and uploads tiles around the camera
+GDK_API void GDK_Terrain_StreamUpdate(int streamIdx) {
+    if (!GDK::state || streamIdx < 0 || (size_t)streamIdx >= g_TerrainStreams.size() || !g_TerrainStreams[streamIdx]) return;
+    GDK_Internal_TerrainStream& s = *g_TerrainStreams[streamIdx];
+    const GDK_TerrainTileHeader& h = *s.header;
+
+    float tileWorld = h.tileSize * s.scaleXZ;
+    int camTX = (int)std::floor(GDK::state->cameraPos.x / tileWorld);
+    int camTZ = (int)std::floor(GDK::state->cameraPos.z / tileWorld);
+
+    // 1. Ring around the camera, nearest first
+    struct Wanted { int dist, tx, tz; };
+    std::vector<Wanted> ring;
+    for (int dz = -s.ringRadius; dz <= s.ringRadius; dz++) {
+        for (int dx = -s.ringRadius; dx <= s.ringRadius; dx++) {
+            int tx = camTX + dx, tz = camTZ + dz;
+            if (tx < 0 || tz < 0 || tx >= (int)h.tilesX || tz >= (int)h.tilesZ) continue;
+            ring.push_back({ dx * dx + dz * dz, tx, tz });
+        }
+    }
+    std::sort(ring.begin(), ring.end(), [](const Wanted& a, const Wanted& b) { return a.dist < b.dist; });
+
+    // 2. Evict anything outside ring + 1 (The extra tile is hysteresis against edge thrashing)
+    for (auto it = s.tiles.begin(); it != s.tiles.end();) {
+        int tx = it->first % h.tilesX, tz = it->first / h.tilesX;
+        int cheb = std::max(std::abs(tx - camTX), std::abs(tz - camTZ));
+        if (cheb > s.ringRadius + 1 && it->second.state != GDK_TILE_BUILDING) {
+            GDK_Internal_FreeStreamTile(s, it->second);
+            it = s.tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 3. Queue builds on the worker pool
+    int maxInFlight = GDK::Jobs::WorkerCount() * 2;
+    for (const auto& w : ring) {
+        if (s.inFlight >= maxInFlight) break;
+        GDK_Internal_TerrainTile& t = s.tiles[w.tz * h.tilesX + w.tx];
+        if (t.state != GDK_TILE_EMPTY) continue;
+
+        t.state = GDK_TILE_BUILDING;
+        s.inFlight++;
+        GDK_Internal_TerrainStream* sp = &s;
+        GDK_Internal_TerrainTile* tp = &t;
+        int tx = w.tx, tz = w.tz;
+        GDK::Jobs::Push([sp, tp, tx, tz]() {
+            GDK_Internal_BuildStreamTile(sp, tp, tx, tz);
+            tp->state = GDK_TILE_READY;
+            sp->inFlight--;
+        });
+    }
+
+    // 4. Budgeted uploads (Always at least one so a tiny budget still makes progress)
+    size_t spent = 0;
+    for (const auto& w : ring) {
+        auto it = s.tiles.find(w.tz * h.tilesX + w.tx);
+        if (it == s.tiles.end() || it->second.state != GDK_TILE_READY) continue;
+        size_t bytes = it->second.verts.size() * sizeof(TerrainVertex);
+        if (spent > 0 && spent + bytes > s.uploadBudget) break;
+        spent += GDK_Internal_UploadStreamTile(s, it->second);
+    }
+}
+
+GDK_API void GDK_Terrain_StreamRender(int streamIdx) {
+    if (streamIdx < 0 || (size_t)streamIdx >= g_TerrainStreams.size() || !g_TerrainStreams[streamIdx]) return;
+    GDK_Internal_TerrainStream& s = *g_TerrainStreams[streamIdx];
+
+    GDK_Internal_BindTerrainTexture(s.textureID);
+
+    for (auto& kv : s.tiles) {
+        GDK_Internal_TerrainTile& t = kv.second;
+        if (t.state != GDK_TILE_RESIDENT) continue;
+
+        if (GDK::mode == GDK_MODE_LEGACY) {
+            glCallList(t.displayList);
+        } else {
+            glBindVertexArray(t.vao);
+            glDrawElements(GL_TRIANGLES, (GLsizei)s.indices.size(), GL_UNSIGNED_INT, 0);
+        }
+    }
+    if (GDK::mode != GDK_MODE_LEGACY) glBindVertexArray(0);
+}
+
+// Reads straight from the mapped file - works even where no tile is resident
+GDK_API float GDK_Terrain_StreamHeight(int streamIdx, float worldX, float worldZ) {
+    if (streamIdx < 0 || (size_t)streamIdx >= g_TerrainStreams.size() || !g_TerrainStreams[streamIdx]) return 0.0f;
+    GDK_Internal_TerrainStream& s = *g_TerrainStreams[streamIdx];
+    const GDK_TerrainTileHeader& h = *s.header;
+
+    float gridX = worldX / s.scaleXZ;
+    float gridZ = worldZ / s.scaleXZ;
+    int x0 = (int)std::floor(gridX);
+    int z0 = (int)std::floor(gridZ);
+    if (x0 < 0 || z0 < 0 || x0 >= (int)(h.tilesX * h.tileSize) || z0 >= (int)(h.tilesZ * h.tileSize)) return 0.0f;
+
+    int tx = x0 / h.tileSize, tz = z0 / h.tileSize;
+    int lx = x0 - tx * h.tileSize, lz = z0 - tz * h.tileSize;
+    const int apron = h.tileSize + 3;
+    const uint16_t* src = GDK_Internal_TileSamples(s, tx, tz);
+    const float hScale = (15.0f * s.scaleY) / 65535.0f;
+    auto H = [&](int x, int z) { return (float)src[(z + 1) * apron + (x + 1)] * hScale; };
+
+    float fracX = gridX - (float)x0;
+    float fracZ = gridZ - (float)z0;
+    float top = H(lx, lz) + (H(lx + 1, lz) - H(lx, lz)) * fracX;
+    float bottom = H(lx, lz + 1) + (H(lx + 1, lz + 1) - H(lx, lz + 1)) * fracX;
+    return top + (bottom - top) * fracZ;
+}
+
+GDK_API int GDK_Terrain_StreamResident(int streamIdx) {
+    if (streamIdx < 0 || (size_t)streamIdx >= g_TerrainStreams.size() || !g_TerrainStreams[streamIdx]) return 0;
+    return g_TerrainStreams[streamIdx]->residentCount;
+}
+
+GDK_API void GDK_Terrain_StreamClose(int streamIdx) {
+    if (streamIdx < 0 || (size_t)streamIdx >= g_TerrainStreams.size() || !g_TerrainStreams[streamIdx]) return;
+    GDK_Internal_TerrainStream* s = g_TerrainStreams[streamIdx];
+
+    // Workers hold raw pointers into the stream - drain them first
+    while (s->inFlight > 0) {
+        if (!GDK::Jobs::Get().RunOne()) std::this_thread::yield();
+    }
+
+    for (auto& kv : s->tiles) GDK_Internal_FreeStreamTile(*s, kv.second);
+    s->tiles.clear();
+    if (s->ebo) glDeleteBuffers(1, &s->ebo);
+    GDK_FreeTexture(s->textureID);
+    s->file.Close();
+
+    delete s;
+    g_TerrainStreams[streamIdx] = nullptr;
+}
+
+GDK_END_DECLS
+
+#endif // GDK_TERRAIN_STREAM_H
@@ -1,79 +1,646 @@
-#ifndef GDK_TEXTURE_H
-#define GDK_TEXTURE_H
-
-
-static uint32_t GDK_Internal_CreateGLTexture(const char* path) {
-    if (!path) return 0;
-
-    std::string filename = path;
-    std::string ext = filename.substr(filename.find_last_of(".") + 1);
-    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-    int w, h, c;
-    unsigned char* data = nullptr;
-    bool is_pcx = (ext == "pcx");
-
-    if (is_pcx) {
-        // Load PCX (Force 4 components / RGBA)
-        data = drpcx_load_file(path, DRPCX_FALSE, &w, &h, &c, 4);
-        
-        // Manual vertical flip for PCX to match STB behavior
-        if (data) {
-            int rowSize = w * 4;
-            std::vector<uint8_t> tempRow(rowSize);
-            for (int y = 0; y < h / 2; ++y) {
-                uint8_t* top = data + (y * rowSize);
-                uint8_t* bottom = data + ((h - 1 - y) * rowSize);
-                memcpy(tempRow.data(), top, rowSize);
-                memcpy(top, bottom, rowSize);
-                memcpy(bottom, tempRow.data(), rowSize);
-            }
-        }
-    } else {
-        // Load Standard (PNG, TGA, BMP, JPG) - Always flipped for OpenGL
-        stbi_set_flip_vertically_on_load(true);
-        data = stbi_load(path, &w, &h, &c, 4);
-    }
-
-    if (!data) return 0;
-
-    uint32_t tid;
-    glGenTextures(1, &tid);
-    glBindTexture(GL_TEXTURE_2D, tid);
-
-    // Standard 1.1 - 3.3 Loading
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-    glGenerateMipmap(GL_TEXTURE_2D);
-
-    // Default Filtering for MD2 compatibility
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-    if (is_pcx) drpcx_free(data);
-    else stbi_image_free(data);
-
-    return tid;
-}
-// Global Registry for sprites/UI
-static std::vector<uint32_t> g_Textures;
-
-GDK_BEGIN_DECLS
-
-// Version A: Returns index for global use
-GDK_API int GDK_LoadTexture(const char* path) {
-    uint32_t tid = GDK_Internal_CreateGLTexture(path);
-    if (tid == 0) return -1;
-    g_Textures.push_back(tid);
-    return (int)g_Textures.size() - 1;
-}
-
-GDK_END_DECLS
-
-// Version B: Direct to model (Internal use)
-GDK_API void GDK_LoadTexture(const char* path, int& target) {
-    target = (int)GDK_Internal_CreateGLTexture(path);
-}
-
+#ifndef GDK_TEXTURE_H
+#define GDK_TEXTURE_H
+
+
+// Load flags - part of the cache key, so the same file loaded clamped and repeated is two textures
+enum GDK_TextureFlags {
+    GDK_TEX_DEFAULT = 0,
+    GDK_TEX_CLAMP   = 1 << 0, // CLAMP_TO_EDGE instead of REPEAT (UI, skies)
+    GDK_TEX_NEAREST = 1 << 1, // No filtering (Pixel art, palette lookups)
+    GDK_TEX_UNCOMPRESSED = 1 << 2 // Keep RGBA8 even when BC compression is on (UI, exact colours)
+};
+
+// Decoded RGBA8 pixels, bottom-up for GL. Safe to run on a worker thread.
+struct GDK_Internal_Image {
+    int w = 0, h = 0;
+    unsigned char* data = nullptr;
+    int source = 0; // Who owns 'data': 0 = stb, 1 = drpcx, 2 = malloc (GDK_Internal_DecodePCX)
+
+    void Free() {
+        if (data) {
+            if (source == 1) drpcx_free(data);
+            else if (source == 2) free(data);
+            else stbi_image_free(data);
+        }
+        data = nullptr;
+    }
+};
+
+static bool GDK_Internal_DecodeImage(const char* path, GDK_Internal_Image& img) {
+    if (!path) return false;
+
+    std::string filename = path;
+    std::string ext = filename.substr(filename.find_last_of(".") + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    int c;
+    if (ext == "pcx") {
+        // Fast path: 8/24/32-bit PCX decoded straight into bottom-up rows (No flip pass)
+        GDK::Internal::MappedFile f;
+        if (f.Open(path) && GDK_Internal_DecodePCX(f.data, f.size, img.w, img.h, img.data)) {
+            img.source = 2;
+            return true;
+        }
+
+        // Load PCX (Force 4 components / RGBA) - EGA/planar formats the fast path skips
+        img.source = 1;
+        img.data = drpcx_load_file(path, DRPCX_FALSE, &img.w, &img.h, &c, 4);
+        
+        // Manual vertical flip for PCX to match STB behavior
+        if (img.data) {
+            int rowSize = img.w * 4;
+            std::vector<uint8_t> tempRow(rowSize);
+            for (int y = 0; y < img.h / 2; ++y) {
+                uint8_t* top = img.data + (y * rowSize);
+                uint8_t* bottom = img.data + ((img.h - 1 - y) * rowSize);
+                memcpy(tempRow.data(), top, rowSize);
+                memcpy(top, bottom, rowSize);
+                memcpy(bottom, tempRow.data(), rowSize);
+            }
+        }
+    } else {
+        // Load Standard (PNG, TGA, BMP, JPG) - Always flipped for OpenGL.
+        // Every loader in the GDK sets the flag to true, so workers never race on a different value.
+        img.source = 0;
+        stbi_set_flip_vertically_on_load(true);
+        img.data = stbi_load(path, &img.w, &img.h, &c, 4);
+    }
+    return img.data != nullptr;
+}
+
+static void GDK_Internal_ApplyTextureParams(int flags) {
+    // Default Filtering for MD2 compatibility
+    bool nearest = (flags & GDK_TEX_NEAREST) != 0;
+    GLint wrap = (flags & GDK_TEX_CLAMP) ? GL_CLAMP_TO_EDGE : GL_REPEAT;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, nearest ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, nearest ? GL_NEAREST : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+}
+
+// Uploads every level of a generated chain into the bound texture and caps MAX_LEVEL to match
+static void GDK_Internal_UploadMipChain(const GDK_Internal_MipChain& chain, GLint internalFormat = GL_RGBA8, int firstLevel = 0) {
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int l = firstLevel; l < chain.Levels(); ++l) {
+        int lw, lh;
+        chain.Dims(l, lw, lh);
+        glTexImage2D(GL_TEXTURE_2D, l, internalFormat, lw, lh, 0, GL_RGBA, GL_UNSIGNED_BYTE, chain.Level(l));
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, chain.Levels() - 1);
+}
+
+static bool GDK_Internal_WantBC(int flags) {
+    return g_TexCompress && !(flags & GDK_TEX_UNCOMPRESSED) && GDK_Internal_BCSupported();
+}
+
+// Worker-safe: the .dds cache if it is current, otherwise decode + encode (+ refresh the cache)
+static bool GDK_Internal_LoadBCImage(const char* path, GDK_Internal_BCImage& out) {
+    if (GDK_Internal_GetBCImage(path, nullptr, 0, 0, out)) return true;
+    GDK_Internal_Image img;
+    if (!GDK_Internal_DecodeImage(path, img)) return false;
+    GDK_Internal_GetBCImage(path, img.data, img.w, img.h, out);
+    img.Free();
+    return true;
+}
+
+static uint32_t GDK_Internal_CreateGLTexture(const char* path, int flags = GDK_TEX_DEFAULT, size_t* outBytes = nullptr) {
+    if (GDK_Internal_WantBC(flags)) {
+        GDK_Internal_BCImage bc;
+        if (!GDK_Internal_LoadBCImage(path, bc)) return 0;
+
+        uint32_t tid;
+        glGenTextures(1, &tid);
+        glBindTexture(GL_TEXTURE_2D, tid);
+        GDK_Internal_UploadBC(bc);
+        GDK_Internal_ApplyTextureParams(flags);
+        if (outBytes) *outBytes = bc.data.size();
+        return tid;
+    }
+
+    GDK_Internal_Image img;
+    if (!GDK_Internal_DecodeImage(path, img)) return 0;
+
+    // Whole chain on the CPU (Linear light, NPOT-safe), then one upload per level
+    GDK_Internal_MipChain chain;
+    GDK_Internal_BuildMipChain(img.data, img.w, img.h, GDK_MIP_DEFAULT, chain);
+    img.Free();
+
+    uint32_t tid;
+    glGenTextures(1, &tid);
+    glBindTexture(GL_TEXTURE_2D, tid);
+    GDK_Internal_UploadMipChain(chain);
+    GDK_Internal_ApplyTextureParams(flags);
+
+    if (outBytes) *outBytes = chain.data.size();
+    return tid;
+}
+
+// Global Registry for sprites/UI
+static std::vector<uint32_t> g_Textures;
+
+// --- TEXTURE CACHE ---
+// One GL texture per (normalised path, flags). Every slot in g_Textures is refcounted;
+// loaders that keep raw GL names (models, PRM pages) go through Acquire/ReleaseName.
+struct GDK_Internal_TextureJob;
+
+struct GDK_Internal_TextureEntry {
+    std::string key;   // Empty = free slot
+    int refs = 0;
+    size_t bytes = 0;
+    uint32_t gen = 0;  // Bumped on free so in-flight async work can tell it is stale
+    std::shared_ptr<GDK_Internal_TextureJob> job; // Non-null while an async load is pending
+    bool failed = false;     // Async load failed - the slot binds nothing
+    bool streamed = false;   // Mip streamed: the GL name is respecified in place, so no handle may freeze it
+    bool handleWanted = false;
+    uint32_t handleTex = 0;  // Streamed slots: copy of the resident window that bindless handles come from
+    size_t handleBytes = 0;  // ...and its VRAM (In g_TextureStats.bytes, not in 'bytes')
+};
+
+struct GDK_TextureStats {
+    uint32_t hits;       // Loads served from the cache
+    uint32_t misses;     // Loads that decoded + uploaded
+    uint32_t resident;   // Live textures
+    uint32_t pending;    // Async loads not yet uploaded
+    uint64_t bytes;      // Estimated VRAM (RGBA8 or BC data, + mips)
+};
+
+static std::vector<GDK_Internal_TextureEntry> g_TextureInfo; // Parallel to g_Textures
+static std::unordered_map<std::string, int> g_TextureCache;  // key -> slot
+static std::unordered_map<uint32_t, int> g_TextureByName;    // GL name -> slot
+static std::vector<int> g_TextureFreeSlots;
+static GDK_TextureStats g_TextureStats = {};
+static uint32_t g_TexPlaceholder = 0;                        // Shared by every pending async slot
+
+// "Data\\Skins\\..\\Ogre.PCX" and "data/ogre.pcx" are the same file on Windows
+static std::string GDK_Internal_NormalizeTexturePath(const char* path, int flags) {
+    std::string p = path;
+    std::replace(p.begin(), p.end(), '\\', '/');
+    std::transform(p.begin(), p.end(), p.begin(), ::tolower);
+
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (start <= p.size()) {
+        size_t end = p.find('/', start);
+        if (end == std::string::npos) end = p.size();
+        std::string seg = p.substr(start, end - start);
+        if (seg == "..") {
+            if (!parts.empty() && parts.back() != "..") parts.pop_back();
+            else parts.push_back(seg);
+        } else if (!seg.empty() && seg != ".") {
+            parts.push_back(seg);
+        }
+        start = end + 1;
+    }
+
+    std::string key = (!p.empty() && p[0] == '/') ? "/" : "";
+    for (size_t i = 0; i < parts.size(); ++i) key += (i ? "/" : "") + parts[i];
+    return key + "|" + std::to_string(flags);
+}
+
+// Claims a slot for a new key with one reference
+static int GDK_Internal_AllocTextureSlot(const std::string& key, uint32_t tid) {
+    int slot;
+    if (!g_TextureFreeSlots.empty()) {
+        slot = g_TextureFreeSlots.back();
+        g_TextureFreeSlots.pop_back();
+        g_Textures[slot] = tid;
+    } else {
+        slot = (int)g_Textures.size();
+        g_Textures.push_back(tid);
+        g_TextureInfo.emplace_back();
+    }
+
+    GDK_Internal_TextureEntry& e = g_TextureInfo[slot];
+    e.key = key; e.refs = 1; e.bytes = 0;
+    g_TextureCache[key] = slot;
+    g_TextureStats.resident++;
+    return slot;
+}
+
+// Returns a slot index with one reference added, or -1
+static int GDK_Internal_AcquireTextureSlot(const char* path, int flags) {
+    if (!path || !*path) return -1;
+    std::string key = GDK_Internal_NormalizeTexturePath(path, flags);
+
+    auto it = g_TextureCache.find(key);
+    if (it != g_TextureCache.end()) {
+        g_TextureInfo[it->second].refs++;
+        g_TextureStats.hits++;
+        return it->second;
+    }
+
+    size_t bytes = 0;
+    uint32_t tid = GDK_Internal_CreateGLTexture(path, flags, &bytes);
+    if (tid == 0) return -1;
+    g_TextureStats.misses++;
+
+    int slot = GDK_Internal_AllocTextureSlot(key, tid);
+    g_TextureInfo[slot].bytes = bytes;
+    g_TextureByName[tid] = slot;
+    g_TextureStats.bytes += bytes;
+    return slot;
+}
+
+static void GDK_Internal_ReleaseTextureSlot(int slot) {
+    if (slot < 0 || (size_t)slot >= g_TextureInfo.size()) return;
+    GDK_Internal_TextureEntry& e = g_TextureInfo[slot];
+    if (e.refs <= 0 || --e.refs > 0) return;
+
+    GDK_Internal_BindlessForget(slot);
+    if (e.handleTex) glDeleteTextures(1, (GLuint*)&e.handleTex);
+    if (e.job) {
+        g_TextureStats.pending--; // Slot still shows the shared placeholder - nothing to delete
+    } else if (g_Textures[slot] && g_Textures[slot] != g_TexPlaceholder) {
+        GLuint tid = g_Textures[slot];
+        glDeleteTextures(1, &tid);
+        g_TextureByName.erase(tid);
+    }
+    g_TextureCache.erase(e.key);
+    g_TextureStats.resident--;
+    g_TextureStats.bytes -= e.bytes + e.handleBytes;
+
+    uint32_t gen = e.gen + 1;
+    e = GDK_Internal_TextureEntry();
+    e.gen = gen;
+    g_Textures[slot] = 0; // Stale handles bind nothing instead of someone else's texture
+    g_TextureFreeSlots.push_back(slot);
+}
+
+// --- ASYNC LOADING ---
+// Decode runs on the job pool; the slot binds a grey placeholder meanwhile. Uploads happen on the
+// GL thread from a frame hook, a few rows at a time, capped at g_TexUploadBudget bytes per frame.
+// Modes 1/2 stage through a 3-segment PBO ring (persistently mapped in AZDO), Legacy uploads straight from RAM.
+struct GDK_Internal_TextureJob {
+    int slot = -1;
+    uint32_t gen = 0;
+    int flags = 0;
+    std::string path;
+    bool compressed = false;          // Decided on the GL thread (Needs the extension check)
+    GDK_Internal_MipChain mips;       // RGBA path (Level 0 + chain, built on the worker)
+    GDK_Internal_BCImage bc;          // Compressed path (Cache hit or encoded on the worker)
+    bool ok = false;
+    std::atomic<bool> decoded{false}; // Set by the worker, everything above is then read-only
+
+    // GL thread only
+    uint32_t tid = 0;
+    int nextRow = 0;                  // RGBA progress
+    int nextLevel = 0;                // Compressed progress
+    bool finished = false;
+
+    bool Uploaded() const { return compressed ? (nextLevel >= bc.Levels()) : (nextRow >= mips.h); }
+};
+
+#define GDK_TEX_RING_SEGMENTS 3
+
+static std::deque<std::shared_ptr<GDK_Internal_TextureJob>> g_TextureUploads; // Request order
+static size_t g_TexUploadBudget = 4 * 1024 * 1024;
+static uint32_t g_TexRingPBO = 0;
+static uint8_t* g_TexRingPtr = nullptr; // AZDO persistent mapping
+static size_t g_TexRingSegSize = 0;
+static GLsync g_TexRingFence[GDK_TEX_RING_SEGMENTS] = {};
+static int g_TexRingSeg = 0;
+
+static uint32_t GDK_Internal_TexturePlaceholder() {
+    if (!g_TexPlaceholder) {
+        const uint8_t grey[4] = { 128, 128, 128, 255 };
+        glGenTextures(1, &g_TexPlaceholder);
+        glBindTexture(GL_TEXTURE_2D, g_TexPlaceholder);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    return g_TexPlaceholder;
+}
+
+static void GDK_Internal_FreeTextureRing() {
+    for (int i = 0; i < GDK_TEX_RING_SEGMENTS; ++i) {
+        if (g_TexRingFence[i]) { glClientWaitSync(g_TexRingFence[i], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); glDeleteSync(g_TexRingFence[i]); }
+        g_TexRingFence[i] = 0;
+    }
+    if (g_TexRingPBO) {
+        if (g_TexRingPtr) { glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_TexRingPBO); glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER); glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); }
+        glDeleteBuffers(1, &g_TexRingPBO);
+    }
+    g_TexRingPBO = 0; g_TexRingPtr = nullptr; g_TexRingSegSize = 0;
+}
+
+static void GDK_Internal_InitTextureRing() {
+    g_TexRingSegSize = g_TexUploadBudget;
+    GLsizeiptr total = (GLsizeiptr)(g_TexRingSegSize * GDK_TEX_RING_SEGMENTS);
+    glGenBuffers(1, &g_TexRingPBO);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_TexRingPBO);
+    if (GDK::mode == GDK_MODE_AZDO) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, total, nullptr, flags);
+        g_TexRingPtr = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, total, flags);
+    } else {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, total, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+// Swaps the finished texture into the slot (Every holder of the index sees it next bind)
+static void GDK_Internal_FinishTextureJob(GDK_Internal_TextureJob& job) {
+    job.finished = true;
+    GDK_Internal_TextureEntry& e = g_TextureInfo[job.slot];
+    e.job.reset();
+    g_TextureStats.pending--;
+
+    if (!job.ok) {
+        printf("[GDK ERR] Async texture failed to load: %s\n", job.path.c_str());
+        job.mips = GDK_Internal_MipChain();
+        e.failed = true;
+        g_Textures[job.slot] = 0; // The placeholder is shared - never hand it out as this slot's texture
+        return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, job.tid);
+    if (job.compressed) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, job.bc.Levels() - 1);
+        e.bytes = job.bc.data.size();
+    } else {
+        GDK_Internal_UploadMipChain(job.mips, GL_RGBA8, 1); // Level 0 went up row by row
+        e.bytes = job.mips.data.size();
+    }
+    g_TextureStats.bytes += e.bytes;
+    g_Textures[job.slot] = job.tid;
+    g_TextureByName[job.tid] = job.slot;
+    job.mips = GDK_Internal_MipChain();
+    job.bc = GDK_Internal_BCImage();
+}
+
+static bool GDK_Internal_TextureJobStale(const GDK_Internal_TextureJob& job) {
+    return g_TextureInfo[job.slot].gen != job.gen;
+}
+
+static void GDK_Internal_BeginTextureUpload(GDK_Internal_TextureJob& job) {
+    glGenTextures(1, &job.tid);
+    glBindTexture(GL_TEXTURE_2D, job.tid);
+    if (!job.compressed) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, job.mips.w, job.mips.h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    GDK_Internal_ApplyTextureParams(job.flags);
+}
+
+// Copies 'bytes' into the ring at 'dst' and returns the pointer GL should read from (An offset when a PBO is bound)
+static const void* GDK_Internal_StageTextureBytes(const uint8_t* src, size_t bytes, size_t dst, bool usePBO) {
+    if (!usePBO) return src;
+    if (g_TexRingPtr) {
+        memcpy(g_TexRingPtr + dst, src, bytes);
+    } else {
+        void* map = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, dst, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (!map) return nullptr;
+        memcpy(map, src, bytes);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+    return (const void*)(uintptr_t)dst;
+}
+
+// Frame hook: moves up to g_TexUploadBudget bytes of decoded rows into GL
+static void GDK_Internal_PumpTextureUploads() {
+    if (g_TextureUploads.empty()) return;
+
+    bool usePBO = (GDK::mode != GDK_MODE_LEGACY);
+    size_t offset = 0;
+    if (usePBO) {
+        if (g_TexRingPBO && g_TexRingSegSize != g_TexUploadBudget) GDK_Internal_FreeTextureRing();
+        if (!g_TexRingPBO) GDK_Internal_InitTextureRing();
+
+        g_TexRingSeg = (g_TexRingSeg + 1) % GDK_TEX_RING_SEGMENTS;
+        GLsync& fence = g_TexRingFence[g_TexRingSeg];
+        if (fence) {
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // Normally signalled frames ago
+            glDeleteSync(fence);
+            fence = 0;
+        }
+        offset = g_TexRingSeg * g_TexRingSegSize;
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_TexRingPBO);
+    }
+
+    size_t used = 0;
+    for (auto& jp : g_TextureUploads) {
+        GDK_Internal_TextureJob& job = *jp;
+        if (job.finished || !job.decoded.load()) continue;
+        if (GDK_Internal_TextureJobStale(job)) {
+            // Freed while loading - drop whatever was built
+            if (job.tid) glDeleteTextures(1, &job.tid);
+            job.mips = GDK_Internal_MipChain();
+            job.finished = true;
+            continue;
+        }
+        if (!job.ok) { GDK_Internal_FinishTextureJob(job); continue; }
+
+        if (!job.tid) GDK_Internal_BeginTextureUpload(job);
+        else glBindTexture(GL_TEXTURE_2D, job.tid);
+
+        if (job.compressed) {
+            // Whole mip levels (4-8x smaller than RGBA). A level bigger than the whole budget goes
+            // straight from RAM, but only as the first upload of a frame.
+            while (job.nextLevel < job.bc.Levels()) {
+                size_t bytes = job.bc.LevelSize(job.nextLevel);
+                const uint8_t* src = job.bc.data.data() + job.bc.offsets[job.nextLevel];
+                const void* pixels;
+                if (used + bytes <= g_TexUploadBudget) {
+                    pixels = GDK_Internal_StageTextureBytes(src, bytes, offset + used, usePBO);
+                    if (!pixels) break;
+                } else if (used == 0) {
+                    if (usePBO) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    GDK_Internal_UploadBCLevel(job.bc, job.nextLevel, src);
+                    if (usePBO) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_TexRingPBO);
+                    job.nextLevel++;
+                    used = g_TexUploadBudget;
+                    break;
+                } else {
+                    break;
+                }
+                GDK_Internal_UploadBCLevel(job.bc, job.nextLevel, pixels);
+                job.nextLevel++;
+                used += bytes;
+            }
+        } else {
+            size_t rowBytes = (size_t)job.mips.w * 4;
+            while (job.nextRow < job.mips.h) {
+                size_t room = g_TexUploadBudget - used;
+                int rows = std::min(job.mips.h - job.nextRow, (int)(room / rowBytes));
+                if (rows <= 0) break;
+
+                size_t bytes = rows * rowBytes;
+                const void* pixels = GDK_Internal_StageTextureBytes(job.mips.Level(0) + job.nextRow * rowBytes, bytes, offset + used, usePBO);
+                if (!pixels) break;
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, job.nextRow, job.mips.w, rows, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+                job.nextRow += rows;
+                used += bytes;
+            }
+        }
+
+        if (job.Uploaded()) {
+            // Mips 1+ go up from RAM - a bound ring would turn those pointers into PBO offsets
+            if (usePBO) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            GDK_Internal_FinishTextureJob(job);
+            if (usePBO) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_TexRingPBO);
+        }
+        if (used >= g_TexUploadBudget) break;
+    }
+
+    if (usePBO) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (used > 0) g_TexRingFence[g_TexRingSeg] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    while (!g_TextureUploads.empty() && g_TextureUploads.front()->finished) g_TextureUploads.pop_front();
+}
+
+// Someone needs the real GL name right now (Version B loaders) - wait for the decode and upload in one go
+static void GDK_Internal_CompleteTextureNow(int slot) {
+    std::shared_ptr<GDK_Internal_TextureJob> jp = g_TextureInfo[slot].job;
+    if (!jp) return;
+    while (!jp->decoded.load()) {
+        if (!GDK::Jobs::Get().RunOne()) std::this_thread::yield();
+    }
+    if (jp->ok) {
+        if (!jp->tid) GDK_Internal_BeginTextureUpload(*jp);
+        else glBindTexture(GL_TEXTURE_2D, jp->tid);
+        if (jp->compressed) {
+            for (; jp->nextLevel < jp->bc.Levels(); jp->nextLevel++) {
+                GDK_Internal_UploadBCLevel(jp->bc, jp->nextLevel, jp->bc.data.data() + jp->bc.offsets[jp->nextLevel]);
+            }
+        } else if (jp->nextRow < jp->mips.h) {
+            size_t rowBytes = (size_t)jp->mips.w * 4;
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, jp->nextRow, jp->mips.w, jp->mips.h - jp->nextRow, GL_RGBA, GL_UNSIGNED_BYTE, jp->mips.Level(0) + jp->nextRow * rowBytes);
+            jp->nextRow = jp->mips.h;
+        }
+    }
+    GDK_Internal_FinishTextureJob(*jp);
+}
+
+static int GDK_Internal_AcquireTextureAsync(const char* path, int flags) {
+    if (!path || !*path) return -1;
+    std::string key = GDK_Internal_NormalizeTexturePath(path, flags);
+
+    auto it = g_TextureCache.find(key);
+    if (it != g_TextureCache.end()) {
+        g_TextureInfo[it->second].refs++;
+        g_TextureStats.hits++;
+        return it->second;
+    }
+    g_TextureStats.misses++;
+    g_TextureStats.pending++;
+
+    int slot = GDK_Internal_AllocTextureSlot(key, GDK_Internal_TexturePlaceholder());
+    auto jp = std::make_shared<GDK_Internal_TextureJob>();
+    jp->slot = slot;
+    jp->gen = g_TextureInfo[slot].gen;
+    jp->flags = flags;
+    jp->path = path;
+    jp->compressed = GDK_Internal_WantBC(flags);
+    g_TextureInfo[slot].job = jp;
+    g_TextureUploads.push_back(jp);
+
+    GDK::Internal::AddFrameHook(GDK_Internal_PumpTextureUploads);
+    GDK::Jobs::Push([jp]() {
+        if (jp->compressed) jp->ok = GDK_Internal_LoadBCImage(jp->path.c_str(), jp->bc);
+        else {
+            GDK_Internal_Image img;
+            jp->ok = GDK_Internal_DecodeImage(jp->path.c_str(), img);
+            if (jp->ok) GDK_Internal_BuildMipChain(img.data, img.w, img.h, GDK_MIP_DEFAULT, jp->mips);
+            img.Free();
+        }
+        jp->decoded.store(true);
+    });
+    return slot;
+}
+
+// Bindless handle for a slot, made resident for this frame (0 outside AZDO / without the extension).
+// Pending async slots get the fallback: the placeholder is shared, so it never gets a per-slot handle.
+// Streamed slots also get it until the mip pump has made their handle copy (Next frame).
+static uint64_t GDK_Internal_TextureHandle(int slot) {
+    if (!GDK_Internal_BindlessAvailable() || slot < 0 || (size_t)slot >= g_TextureInfo.size()) return 0;
+    GDK_Internal_TextureEntry& e = g_TextureInfo[slot];
+    if (e.streamed) e.handleWanted = true;
+    uint32_t tex = e.streamed ? e.handleTex : g_Textures[slot];
+    if (e.job || !tex) {
+        GDK_Internal_BindlessInitFallback();
+        return g_BindlessFallback;
+    }
+    return GDK_Internal_BindlessTouch(slot, tex, e.bytes);
+}
+
+// For loaders that store GL names directly
+static uint32_t GDK_Internal_AcquireTexture(const char* path, int flags = GDK_TEX_DEFAULT) {
+    int slot = GDK_Internal_AcquireTextureSlot(path, flags);
+    if (slot < 0) return 0;
+    GDK_Internal_CompleteTextureNow(slot); // Placeholder names must never leak into models
+    if (!g_Textures[slot]) { GDK_Internal_ReleaseTextureSlot(slot); return 0; } // Failed async load
+    return g_Textures[slot];
+}
+
+static void GDK_Internal_ReleaseTextureName(uint32_t tid) {
+    if (tid == 0) return;
+    auto it = g_TextureByName.find(tid);
+    if (it != g_TextureByName.end()) GDK_Internal_ReleaseTextureSlot(it->second);
+    else glDeleteTextures(1, (GLuint*)&tid); // Not cache-owned (Embedded skins etc.)
+}
+
+GDK_BEGIN_DECLS
+
+// Version A: Returns index for global use. Loading the same file again returns the same index.
+GDK_API int GDK_LoadTexture(const char* path) {
+    return GDK_Internal_AcquireTextureSlot(path, GDK_TEX_DEFAULT);
+}
+
+GDK_API int GDK_LoadTextureEx(const char* path, int flags) {
+    return GDK_Internal_AcquireTextureSlot(path, flags);
+}
+
+// Returns immediately. The index binds a grey placeholder until the upload finishes (See GDK_TextureReady).
+GDK_API int GDK_LoadTextureAsync(const char* path, int flags) {
+    return GDK_Internal_AcquireTextureAsync(path, flags);
+}
+
+// 1 = uploaded, 0 = still loading, -1 = the load failed (The index binds nothing; free it as usual)
+GDK_API int GDK_TextureReady(int texIdx) {
+    if (texIdx < 0 || (size_t)texIdx >= g_TextureInfo.size() || g_TextureInfo[texIdx].refs <= 0) return 0;
+    if (g_TextureInfo[texIdx].failed) return -1;
+    return g_TextureInfo[texIdx].job ? 0 : 1;
+}
+
+// Upload cap per frame, in KB (Default 4096). Also sizes the PBO ring segments.
+GDK_API void GDK_Texture_SetUploadBudget(int kbPerFrame) {
+    g_TexUploadBudget = (size_t)std::max(256, kbPerFrame) * 1024;
+}
+
+// Drops one reference. The GL texture goes away when the last holder frees it.
+GDK_API void GDK_FreeTexture(int texIdx) {
+    GDK_Internal_ReleaseTextureSlot(texIdx);
+}
+
+// AZDO: makes the texture resident and returns its 64-bit handle. The same handle also sits at
+// gdk_Textures[texIdx] in the bindless table (See GDK_Bindless_GLSL). Call once per frame per texture used.
+GDK_API uint64_t GDK_Texture_GetHandle(int texIdx) {
+    return GDK_Internal_TextureHandle(texIdx);
+}
+
+GDK_API void GDK_GetTextureStats(GDK_TextureStats* out) {
+    if (out) *out = g_TextureStats;
+}
+
+// Offline bake: builds (or refreshes) the .dds cache for one image without touching GL. Returns 1 on success.
+GDK_API int GDK_Texture_BakeCompressed(const char* path) {
+    GDK_Internal_SourceStamp stamp;
+    if (!path || !GDK_Internal_GetSourceStamp(path, stamp)) return 0;
+    GDK_Internal_BCImage bc;
+    if (GDK_Internal_ReadBCCache(path, stamp, bc)) return 1;
+
+    GDK_Internal_Image img;
+    if (!GDK_Internal_DecodeImage(path, img)) return 0;
+    GDK_Internal_EncodeBC(img.data, img.w, img.h, true, bc);
+    img.Free();
+    return GDK_Internal_WriteBCCache(path, stamp, bc) ? 1 : 0;
+}
+
+GDK_END_DECLS
+
+// Version B: Direct to model (Internal use). Pair with GDK_Internal_ReleaseTextureName.
+GDK_API void GDK_LoadTexture(const char* path, int& target) {
+    target = (int)GDK_Internal_AcquireTexture(path);
+}
+
 #endif // GDK_TEXTURE_H
\ No newline at end of file
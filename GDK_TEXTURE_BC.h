@@ -0,0 +1,296 @@
+#ifndef GDK_TEXTURE_BC_H
+#define GDK_TEXTURE_BC_H
+
+// --- BLOCK COMPRESSION (BC1 / BC3) ---
+// CPU encoder + DDS cache. Opaque images go BC1 (8:1 vs RGBA8), anything with alpha goes BC3 (4:1).
+// The cache stamps the source size + write time into the DDS reserved words, so editing the
+// source image rebuilds it on the next load. Runs fine on a worker thread (No GL in here except Upload).
+
+#define GDK_BC_CACHE_VERSION 2 // 2: mips from the linear-light generator
+#define GDK_BC_STAMP_MAGIC   0x434B4447 // 'GDKC'
+
+static bool g_TexCompress = true;      // GDK_Texture_SetCompression
+static std::string g_TexCacheDir;      // Empty = "<source>.dds" next to the source
+
+struct GDK_Internal_BCImage {
+    GLenum format = 0;                 // GL_COMPRESSED_RGB(A)_S3TC_DXT1/5_EXT
+    int w = 0, h = 0;
+    std::vector<uint8_t> data;         // All levels back to back
+    std::vector<size_t> offsets;       // Start of each level in 'data' (size = level count)
+
+    int Levels() const { return (int)offsets.size(); }
+    size_t LevelSize(int l) const { return ((l + 1 < Levels()) ? offsets[l + 1] : data.size()) - offsets[l]; }
+};
+
+struct GDK_Internal_SourceStamp {
+    uint32_t sizeLo = 0, sizeHi = 0, timeLo = 0, timeHi = 0;
+};
+
+static bool GDK_Internal_BCSupported() {
+    return GLEW_EXT_texture_compression_s3tc != 0;
+}
+
+// --- 1. BLOCK ENCODERS ---
+static inline uint16_t GDK_Internal_Pack565(int r, int g, int b) {
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static inline void GDK_Internal_Unpack565(uint16_t c, int out[3]) {
+    int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+    out[0] = (r << 3) | (r >> 2); out[1] = (g << 2) | (g >> 4); out[2] = (b << 3) | (b >> 2);
+}
+
+// 4x4 RGBA block -> 8 byte colour block. Inset bounding box along the dominant diagonal
+// (van Waveren, "Real-Time DXT Compression"), always 4-colour mode so it doubles as the BC3 colour half.
+static void GDK_Internal_EncodeBC1Block(const uint8_t* px, uint8_t* out) {
+    int mn[3] = { 255, 255, 255 }, mx[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) { mn[c] = std::min(mn[c], (int)px[i * 4 + c]); mx[c] = std::max(mx[c], (int)px[i * 4 + c]); }
+    }
+
+    // Pick the box diagonal that follows the colours (R and B relative to G)
+    int mid[3] = { (mn[0] + mx[0]) / 2, (mn[1] + mx[1]) / 2, (mn[2] + mx[2]) / 2 };
+    int covRG = 0, covBG = 0;
+    for (int i = 0; i < 16; ++i) {
+        int dg = px[i * 4 + 1] - mid[1];
+        covRG += (px[i * 4 + 0] - mid[0]) * dg;
+        covBG += (px[i * 4 + 2] - mid[2]) * dg;
+    }
+    if (covRG < 0) std::swap(mn[0], mx[0]);
+    if (covBG < 0) std::swap(mn[2], mx[2]);
+
+    for (int c = 0; c < 3; ++c) {
+        int inset = (mx[c] - mn[c]) / 16;
+        mn[c] += inset; mx[c] -= inset;
+    }
+
+    uint16_t c0 = GDK_Internal_Pack565(mx[0], mx[1], mx[2]);
+    uint16_t c1 = GDK_Internal_Pack565(mn[0], mn[1], mn[2]);
+    if (c0 < c1) std::swap(c0, c1);
+
+    int pal[4][3];
+    GDK_Internal_Unpack565(c0, pal[0]);
+    GDK_Internal_Unpack565(c1, pal[1]);
+    for (int c = 0; c < 3; ++c) {
+        pal[2][c] = (2 * pal[0][c] + pal[1][c]) / 3;
+        pal[3][c] = (pal[0][c] + 2 * pal[1][c]) / 3;
+    }
+
+    uint32_t bits = 0;
+    if (c0 != c1) {
+        for (int i = 0; i < 16; ++i) {
+            int best = 0, bestErr = 1 << 30;
+            for (int k = 0; k < 4; ++k) {
+                int dr = px[i * 4] - pal[k][0], dg = px[i * 4 + 1] - pal[k][1], db = px[i * 4 + 2] - pal[k][2];
+                int err = dr * dr + dg * dg + db * db;
+                if (err < bestErr) { bestErr = err; best = k; }
+            }
+            bits |= (uint32_t)best << (i * 2);
+        }
+    }
+
+    out[0] = (uint8_t)c0; out[1] = (uint8_t)(c0 >> 8);
+    out[2] = (uint8_t)c1; out[3] = (uint8_t)(c1 >> 8);
+    memcpy(out + 4, &bits, 4);
+}
+
+// 4x4 RGBA block -> 8 byte alpha block (8-value mode) + 8 byte colour block
+static void GDK_Internal_EncodeBC3Block(const uint8_t* px, uint8_t* out) {
+    int amin = 255, amax = 0;
+    for (int i = 0; i < 16; ++i) { amin = std::min(amin, (int)px[i * 4 + 3]); amax = std::max(amax, (int)px[i * 4 + 3]); }
+
+    int pal[8] = { amax, amin };
+    for (int k = 1; k < 7; ++k) pal[k + 1] = ((7 - k) * amax + k * amin) / 7;
+
+    uint64_t bits = 0;
+    if (amax != amin) {
+        for (int i = 0; i < 16; ++i) {
+            int best = 0, bestErr = 1 << 30;
+            for (int k = 0; k < 8; ++k) {
+                int err = std::abs(px[i * 4 + 3] - pal[k]);
+                if (err < bestErr) { bestErr = err; best = k; }
+            }
+            bits |= (uint64_t)best << (i * 3);
+        }
+    }
+
+    out[0] = (uint8_t)amax; out[1] = (uint8_t)amin;
+    for (int b = 0; b < 6; ++b) out[2 + b] = (uint8_t)(bits >> (b * 8));
+    GDK_Internal_EncodeBC1Block(px, out + 8);
+}
+
+// --- 2. IMAGE ENCODER ---
+static void GDK_Internal_EncodeBCLevel(const uint8_t* rgba, int w, int h, bool bc3, uint8_t* out) {
+    int bw = (w + 3) / 4, bh = (h + 3) / 4;
+    size_t blockBytes = bc3 ? 16 : 8;
+
+    GDK::Jobs::ParallelFor(bh, 8, [&](int by0, int by1) {
+        uint8_t block[64];
+        for (int by = by0; by < by1; ++by) {
+            for (int bx = 0; bx < bw; ++bx) {
+                // Edge blocks clamp to the last row/column
+                for (int y = 0; y < 4; ++y) {
+                    int sy = std::min(by * 4 + y, h - 1);
+                    for (int x = 0; x < 4; ++x) {
+                        int sx = std::min(bx * 4 + x, w - 1);
+                        memcpy(block + (y * 4 + x) * 4, rgba + ((size_t)sy * w + sx) * 4, 4);
+                    }
+                }
+                uint8_t* dst = out + ((size_t)by * bw + bx) * blockBytes;
+                if (bc3) GDK_Internal_EncodeBC3Block(block, dst);
+                else GDK_Internal_EncodeBC1Block(block, dst);
+            }
+        }
+    });
+}
+
+// Encodes level 0 (+ the full mip chain down to 1x1 if 'mips')
+static void GDK_Internal_EncodeBC(const uint8_t* rgba, int w, int h, bool mips, GDK_Internal_BCImage& out) {
+    bool alpha = false;
+    for (size_t i = 3; i < (size_t)w * h * 4 && !alpha; i += 4) alpha = (rgba[i] != 255);
+
+    out.format = alpha ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    out.w = w; out.h = h;
+    out.data.clear(); out.offsets.clear();
+    size_t blockBytes = alpha ? 16 : 8;
+
+    // Mips come from the shared generator (Linear light + alpha coverage), then each level is encoded
+    GDK_Internal_MipChain chain;
+    if (mips) GDK_Internal_BuildMipChain(rgba, w, h, GDK_MIP_DEFAULT, chain);
+    int levels = mips ? chain.Levels() : 1;
+
+    for (int l = 0; l < levels; ++l) {
+        int lw = std::max(1, w >> l), lh = std::max(1, h >> l);
+        size_t bytes = (size_t)((lw + 3) / 4) * ((lh + 3) / 4) * blockBytes;
+        out.offsets.push_back(out.data.size());
+        out.data.resize(out.data.size() + bytes);
+        GDK_Internal_EncodeBCLevel(mips ? chain.Level(l) : rgba, lw, lh, alpha, out.data.data() + out.offsets.back());
+    }
+}
+
+// --- 3. DDS CACHE ---
+#pragma pack(push, 1)
+struct GDK_DDS_Header {
+    uint32_t magic;            // "DDS "
+    uint32_t size, flags, height, width, pitchOrLinearSize, depth, mipMapCount;
+    uint32_t reserved1[11];    // [0] 'GDKC' [1] version [2..3] source size [4..5] source write time
+    uint32_t pfSize, pfFlags, pfFourCC, pfRGBBitCount, pfMasks[4];
+    uint32_t caps, caps2, caps3, caps4, reserved2;
+};
+#pragma pack(pop)
+
+static bool GDK_Internal_GetSourceStamp(const char* path, GDK_Internal_SourceStamp& out) {
+    WIN32_FILE_ATTRIBUTE_DATA info;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &info)) return false;
+    out.sizeLo = info.nFileSizeLow; out.sizeHi = info.nFileSizeHigh;
+    out.timeLo = info.ftLastWriteTime.dwLowDateTime; out.timeHi = info.ftLastWriteTime.dwHighDateTime;
+    return true;
+}
+
+static std::string GDK_Internal_BCCachePath(const char* path) {
+    if (g_TexCacheDir.empty()) return std::string(path) + ".dds";
+
+    // Flat cache dir - name by FNV-1a of the lower-cased path so different folders never collide
+    uint64_t hash = 1469598103934665603ull;
+    for (const char* p = path; *p; ++p) {
+        char c = (*p == '\\') ? '/' : (char)tolower((unsigned char)*p);
+        hash = (hash ^ (uint8_t)c) * 1099511628211ull;
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.dds", (unsigned long long)hash);
+    return g_TexCacheDir + "/" + name;
+}
+
+static bool GDK_Internal_ReadBCCache(const char* path, const GDK_Internal_SourceStamp& stamp, GDK_Internal_BCImage& out) {
+    GDK::Internal::MappedFile f;
+    if (!f.Open(GDK_Internal_BCCachePath(path).c_str())) return false;
+    if (f.size < sizeof(GDK_DDS_Header)) return false;
+
+    GDK_DDS_Header hdr;
+    memcpy(&hdr, f.data, sizeof(hdr));
+    if (hdr.magic != 0x20534444 || hdr.reserved1[0] != GDK_BC_STAMP_MAGIC || hdr.reserved1[1] != GDK_BC_CACHE_VERSION) return false;
+    if (hdr.reserved1[2] != stamp.sizeLo || hdr.reserved1[3] != stamp.sizeHi ||
+        hdr.reserved1[4] != stamp.timeLo || hdr.reserved1[5] != stamp.timeHi) return false; // Source changed
+
+    size_t blockBytes;
+    if (hdr.pfFourCC == 0x31545844) { out.format = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; blockBytes = 8; }        // "DXT1"
+    else if (hdr.pfFourCC == 0x35545844) { out.format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; blockBytes = 16; } // "DXT5"
+    else return false;
+
+    out.w = (int)hdr.width; out.h = (int)hdr.height;
+    out.offsets.clear();
+    size_t total = 0;
+    int lw = out.w, lh = out.h;
+    for (uint32_t l = 0; l < std::max(1u, hdr.mipMapCount); ++l) {
+        out.offsets.push_back(total);
+        total += (size_t)((lw + 3) / 4) * ((lh + 3) / 4) * blockBytes;
+        lw = std::max(1, lw / 2); lh = std::max(1, lh / 2);
+    }
+    if (f.size < sizeof(hdr) + total) return false; // Truncated write
+
+    out.data.assign(f.data + sizeof(hdr), f.data + sizeof(hdr) + total);
+    return true;
+}
+
+static bool GDK_Internal_WriteBCCache(const char* path, const GDK_Internal_SourceStamp& stamp, const GDK_Internal_BCImage& img) {
+    if (!g_TexCacheDir.empty()) CreateDirectoryA(g_TexCacheDir.c_str(), NULL);
+
+    GDK_DDS_Header hdr = {};
+    hdr.magic = 0x20534444;
+    hdr.size = 124;
+    hdr.flags = 0x1 | 0x2 | 0x4 | 0x1000 | 0x80000 | (img.Levels() > 1 ? 0x20000 : 0); // CAPS|HEIGHT|WIDTH|PIXELFORMAT|LINEARSIZE|MIPMAPCOUNT
+    hdr.height = img.h; hdr.width = img.w;
+    hdr.pitchOrLinearSize = (uint32_t)img.LevelSize(0);
+    hdr.mipMapCount = img.Levels();
+    hdr.reserved1[0] = GDK_BC_STAMP_MAGIC;
+    hdr.reserved1[1] = GDK_BC_CACHE_VERSION;
+    hdr.reserved1[2] = stamp.sizeLo; hdr.reserved1[3] = stamp.sizeHi;
+    hdr.reserved1[4] = stamp.timeLo; hdr.reserved1[5] = stamp.timeHi;
+    hdr.pfSize = 32;
+    hdr.pfFlags = 0x4; // FOURCC
+    hdr.pfFourCC = (img.format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) ? 0x35545844 : 0x31545844;
+    hdr.caps = 0x1000 | (img.Levels() > 1 ? (0x400000 | 0x8) : 0); // TEXTURE (| MIPMAP | COMPLEX)
+
+    std::string out = GDK_Internal_BCCachePath(path);
+    FILE* f = fopen(out.c_str(), "wb");
+    if (!f) return false; // Read-only install - still fine, we just re-encode next time
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(img.data.data(), 1, img.data.size(), f) == img.data.size();
+    fclose(f);
+    if (!ok) remove(out.c_str());
+    return ok;
+}
+
+// Cache hit, or decode-side fallback: encode 'rgba' and write the cache. 'rgba' may be NULL for a lookup only.
+static bool GDK_Internal_GetBCImage(const char* path, const uint8_t* rgba, int w, int h, GDK_Internal_BCImage& out) {
+    GDK_Internal_SourceStamp stamp;
+    bool stamped = GDK_Internal_GetSourceStamp(path, stamp);
+    if (stamped && GDK_Internal_ReadBCCache(path, stamp, out)) return true;
+    if (!rgba) return false;
+
+    GDK_Internal_EncodeBC(rgba, w, h, true, out);
+    if (stamped) GDK_Internal_WriteBCCache(path, stamp, out);
+    return true;
+}
+
+// GL thread only. Texture must be bound.
+static void GDK_Internal_UploadBCLevel(const GDK_Internal_BCImage& img, int level, const void* pixels) {
+    int lw = std::max(1, img.w >> level), lh = std::max(1, img.h >> level);
+    glCompressedTexImage2D(GL_TEXTURE_2D, level, img.format, lw, lh, 0, (GLsizei)img.LevelSize(level), pixels);
+}
+
+static void GDK_Internal_UploadBC(const GDK_Internal_BCImage& img) {
+    for (int l = 0; l < img.Levels(); ++l) GDK_Internal_UploadBCLevel(img, l, img.data.data() + img.offsets[l]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, img.Levels() - 1);
+}
+
+GDK_BEGIN_DECLS
+
+// Global switch (Default on). Textures already loaded keep their format.
+GDK_API void GDK_Texture_SetCompression(int enable) { g_TexCompress = (enable != 0); }
+
+// Where .dds caches go. NULL/"" = next to each source file.
+GDK_API void GDK_Texture_SetCacheDir(const char* dir) { g_TexCacheDir = dir ? dir : ""; }
+
+GDK_END_DECLS
+
+#endif // GDK_TEXTURE_BC_H
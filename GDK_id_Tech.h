@@ -1,120 +1,224 @@
-#ifndef GDK_LEGACY_TYPES_H
-#define GDK_LEGACY_TYPES_H
-
-struct GDK_Legacy_Vert {
-    float x, y, z;    
-    float nx, ny, nz; 
-    float u, v;       
-};
-
-struct GDK_Animation {
-    int Start, End, Current; 
-    float Speed, Timer, Lerp;
-    bool Looping; 
-    int Priority; 
-};
-
-// 1. Define the internal Tag structure first
-struct GDK_MD3_Tag_Data { 
-    std::string name; 
-    glm::vec3 pos; 
-    glm::mat3 axis; 
-};
-
-// 2. Define the Hierarchy container
-struct GDK_MD3_Hierarchy {
-     std::vector<std::vector<GDK_MD3_Tag_Data>> tagFrames;
-};
-
-// --- QUAKE 3 MD3 FILE STRUCTURES ---
-#pragma pack(push, 1)
-struct MD3_Header {
-    int32_t ident, version;
-    char name[64];
-    int32_t flags, num_frames, num_tags, num_surfaces, num_skins;
-    int32_t offset_frames, offset_tags, offset_surfaces, offset_eof;
-};
-
-struct MD3_Tag { // The raw file structure
-    char name[64];
-    glm::vec3 pos;
-    glm::mat3 axis;
-};
-
-struct MD3_Surface {
-    int32_t ident;
-    char name[64];
-    int32_t flags, num_frames, num_shaders, num_verts, num_tris;
-    int32_t offset_tris, offset_shaders, offset_st, offset_xyznormal, offset_end;
-};
-
-struct MD3_Triangle { int32_t indexes[3]; };
-struct MD3_TexCoord { float u, v; };
-struct MD3_Vertex   { int16_t x, y, z, normal; };
-#pragma pack(pop)
-
-// --- QUAKE 2 MD2 FILE STRUCTURES ---
-#pragma pack(push, 1)
-struct MD2_Header {
-    int32_t magic, version, skinwidth, skinheight, framesize;
-    int32_t num_skins, num_vertices, num_st, num_tris, num_glcmds, num_frames;
-    int32_t offset_skins, offset_st, offset_tris, offset_frames, offset_glcmds, offset_end;
-};
-struct MD2_Alias_ST { int16_t s, t; };
-struct MD2_Alias_Triangle { uint16_t vertex[3], st[3]; };
-struct MD2_Alias_Vert { uint8_t v[3], lightNormalIndex; };
-#pragma pack(pop)
-
-// --- QUAKE 1 MDL FILE STRUCTURES ---
-#pragma pack(push, 1)
-typedef struct {
-    int32_t id, version;
-    float scale[3], translate[3], boundingradius, eyePosition[3];
-    int32_t numskins, skinwidth, skinheight, numverts, numtris, numframes, synctype, flags;
-    float size;
-} mdl_header_t;
-typedef struct { int32_t onseam, s, t; } mdl_stvert_t;
-typedef struct { int32_t facesfront, vertindex[3]; } mdl_triangle_t;
-typedef struct { uint8_t v[3], lightnormalindex; } mdl_trivert_t;
-#pragma pack(pop)
-
-
-
-
-// --- THE MASTER MODEL STRUCT ---
-struct GDK_Legacy_Model {
-    GDK_ModelType type;
-    uint32_t defaultTex;
-    int numTris, numVerts, numFrames, numTags;
-    bool InUse;
-
-    std::vector<uint32_t> indices;
-    std::vector<std::vector<GDK_Legacy_Vert>> frames; 
-
-    GDK_MD3_Hierarchy* hierarchy = nullptr; 
-
-    std::map<int, GDK_Animation> animLibrary;
-    int NumAnims;
-
-    bool HasHierarchy() const { return hierarchy != nullptr; }
-
-    void Free() {
-
-        if (defaultTex > 0) {
-            glDeleteTextures(1, (GLuint*)&defaultTex);
-            defaultTex = 0;
-        }
-        if (hierarchy) {
-            delete hierarchy; // Kill the MD3 tag data
-            hierarchy = nullptr;
-        }
-        indices.clear();
-        frames.clear();
-        animLibrary.clear();
-        InUse = false;
-    }
-};
-
-static std::vector<GDK_Legacy_Model> g_ModelStore;
-
-#endif
+#ifndef GDK_LEGACY_TYPES_H
+#define GDK_LEGACY_TYPES_H
+
+struct GDK_Legacy_Vert {
+    float x, y, z;    
+    float nx, ny, nz; 
+    float u, v;       
+};
+
+struct GDK_Animation {
+    int Start, End, Current; 
+    float Speed, Timer, Lerp;
+    bool Looping; 
+    int Priority; 
+};
+
+// 1. Define the internal Tag structure first (Names live once per model in GDK_MD3_Hierarchy::tagIds)
+struct GDK_MD3_Tag_Data { 
+    glm::vec3 pos; 
+    glm::mat3 axis; 
+};
+
+// Tag names interned engine-wide, so "tag_torso" is the same integer on every model
+static std::vector<std::string> g_TagNames;
+static std::unordered_map<std::string, int> g_TagLookup;
+
+static int GDK_Internal_InternTag(const std::string& name) {
+    auto it = g_TagLookup.find(name);
+    if (it != g_TagLookup.end()) return it->second;
+    int id = (int)g_TagNames.size();
+    g_TagNames.push_back(name);
+    g_TagLookup[name] = id;
+    return id;
+}
+
+// Per-frame bounds (Model space): box + the tightest sphere around the box centre
+struct GDK_Legacy_Bounds {
+    glm::vec3 min, max, center;
+    float radius;
+};
+
+static void GDK_Internal_ComputeBounds(const GDK_Legacy_Vert* verts, size_t n, GDK_Legacy_Bounds& b) {
+    b.min = glm::vec3(0.0f); b.max = glm::vec3(0.0f);
+    if (n) {
+        b.min = b.max = glm::vec3(verts[0].x, verts[0].y, verts[0].z);
+        for (size_t i = 1; i < n; ++i) {
+            glm::vec3 p(verts[i].x, verts[i].y, verts[i].z);
+            b.min = glm::min(b.min, p);
+            b.max = glm::max(b.max, p);
+        }
+    }
+    b.center = (b.min + b.max) * 0.5f;
+    float r2 = 0.0f;
+    for (size_t i = 0; i < n; ++i) {
+        glm::vec3 d = glm::vec3(verts[i].x, verts[i].y, verts[i].z) - b.center;
+        r2 = std::max(r2, glm::dot(d, d));
+    }
+    b.radius = std::sqrt(r2);
+}
+
+#define GDK_LOD_MAX 3 // Simplified levels below full detail
+
+// One MD3 surface: a contiguous range of the unrolled frame arrays with its own material
+struct GDK_Legacy_Surface {
+    std::string name;     // As in the .md3 (What .skin files refer to)
+    std::string shader;   // First shader path stored in the .md3 (Fallback when no .skin names it)
+    uint32_t firstVert = 0, numVerts = 0;
+    uint32_t texture = 0; // GL name from the texture cache, 0 = use defaultTex
+    uint32_t lodFirst[GDK_LOD_MAX] = {}, lodCount[GDK_LOD_MAX] = {}; // Range in GDK_Legacy_LOD::indices
+};
+
+// One simplified level. Topology is shared by every frame: each LOD vertex is an original vertex,
+// so its frames are a gather of the full frames and it animates/blends like the full mesh.
+struct GDK_Legacy_LOD {
+    std::vector<uint32_t> source;   // Original vertex (Index into frames[f]) per LOD vertex
+    std::vector<uint32_t> indices;  // Triangles over 'source', grouped by surface
+    float error = 0.0f;             // Model-space deviation accepted for this level
+    std::vector<std::vector<GDK_Legacy_Vert>> frames; // Gathered at load (GDK_Internal_GatherLODFrames)
+    uint32_t ebo = 0;               // Modern modes
+};
+
+// LOD hysteresis per instance. Draws tagged with GDK_Model_SetLODInstance are keyed by that id; untagged
+// ones fall back to draw order (The n-th untagged draw of a model this frame follows the n-th last frame).
+struct GDK_Internal_LODHistory {
+    int8_t lod = -1;
+    int frame = 0;   // Last frame this instance was drawn
+};
+
+struct GDK_Internal_LODState {
+    int frame = -1;
+    uint32_t seq = 0;
+    std::unordered_map<uint32_t, GDK_Internal_LODHistory> history; // Untagged draws use 0x80000000 | seq
+};
+
+// 2. Define the Hierarchy container
+struct GDK_MD3_Hierarchy {
+     std::vector<int> tagIds;                               // Interned name per tag slot
+     std::vector<std::vector<GDK_MD3_Tag_Data>> tagFrames;  // [frame][slot]
+
+     int Slot(int tagId) const {
+         for (size_t i = 0; i < tagIds.size(); ++i) if (tagIds[i] == tagId) return (int)i;
+         return -1;
+     }
+};
+
+// --- QUAKE 3 MD3 FILE STRUCTURES ---
+#pragma pack(push, 1)
+struct MD3_Header {
+    int32_t ident, version;
+    char name[64];
+    int32_t flags, num_frames, num_tags, num_surfaces, num_skins;
+    int32_t offset_frames, offset_tags, offset_surfaces, offset_eof;
+};
+
+struct MD3_Tag { // The raw file structure
+    char name[64];
+    glm::vec3 pos;
+    glm::mat3 axis;
+};
+
+struct MD3_Surface {
+    int32_t ident;
+    char name[64];
+    int32_t flags, num_frames, num_shaders, num_verts, num_tris;
+    int32_t offset_tris, offset_shaders, offset_st, offset_xyznormal, offset_end;
+};
+
+struct MD3_Shader { char name[64]; int32_t index; };
+struct MD3_Triangle { int32_t indexes[3]; };
+struct MD3_TexCoord { float u, v; };
+struct MD3_Vertex   { int16_t x, y, z, normal; };
+#pragma pack(pop)
+
+// --- QUAKE 2 MD2 FILE STRUCTURES ---
+#pragma pack(push, 1)
+struct MD2_Header {
+    int32_t magic, version, skinwidth, skinheight, framesize;
+    int32_t num_skins, num_vertices, num_st, num_tris, num_glcmds, num_frames;
+    int32_t offset_skins, offset_st, offset_tris, offset_frames, offset_glcmds, offset_end;
+};
+struct MD2_Alias_ST { int16_t s, t; };
+struct MD2_Alias_Triangle { uint16_t vertex[3], st[3]; };
+struct MD2_Alias_Vert { uint8_t v[3], lightNormalIndex; };
+#pragma pack(pop)
+
+// --- QUAKE 1 MDL FILE STRUCTURES ---
+#pragma pack(push, 1)
+typedef struct {
+    int32_t id, version;
+    float scale[3], translate[3], boundingradius, eyePosition[3];
+    int32_t numskins, skinwidth, skinheight, numverts, numtris, numframes, synctype, flags;
+    float size;
+} mdl_header_t;
+typedef struct { int32_t onseam, s, t; } mdl_stvert_t;
+typedef struct { int32_t facesfront, vertindex[3]; } mdl_triangle_t;
+typedef struct { uint8_t v[3], lightnormalindex; } mdl_trivert_t;
+#pragma pack(pop)
+
+
+
+
+// --- THE MASTER MODEL STRUCT ---
+struct GDK_Legacy_Model {
+    GDK_ModelType type;
+    uint32_t defaultTex;
+    int numTris, numVerts, numFrames, numTags;
+    bool InUse;
+
+    std::vector<uint32_t> indices;
+    std::vector<std::vector<GDK_Legacy_Vert>> frames; 
+    std::vector<GDK_Legacy_Bounds> frameBounds; // One per frame (Baked with the model)
+    std::vector<GDK_Legacy_Surface> surfaces;   // MD3 only, sorted by texture so draws batch by material
+
+    // MD2 GL commands: frames hold strip/fan ordered verts instead of a triangle list (Empty = GL_TRIANGLES)
+    std::vector<GLint> stripFirst, fanFirst;
+    std::vector<GLsizei> stripCount, fanCount;
+
+    // Modern modes (Core profile): the drawn frame is streamed into this VBO
+    uint32_t vao = 0, vbo = 0;
+    int vboFrame = -1;
+
+    std::vector<GDK_Legacy_LOD> lods;  // Coarser and coarser (GDK_MODEL_LOD.h)
+    GDK_Internal_LODState lodState;
+
+    GDK_MD3_Hierarchy* hierarchy = nullptr; 
+    float radius = -1.0f; // Bounding radius over all frames, computed on first draw (< 0 = not yet)
+
+    std::map<int, GDK_Animation> animLibrary;
+    int NumAnims;
+
+    bool HasHierarchy() const { return hierarchy != nullptr; }
+
+    void Free() {
+
+        if (defaultTex > 0) {
+            GDK_Internal_ReleaseTextureName(defaultTex); // Shared skins stay alive for other models
+            defaultTex = 0;
+        }
+        for (auto& s : surfaces) GDK_Internal_ReleaseTextureName(s.texture);
+        surfaces.clear();
+        if (hierarchy) {
+            delete hierarchy; // Kill the MD3 tag data
+            hierarchy = nullptr;
+        }
+        indices.clear();
+        frames.clear();
+        frameBounds.clear();
+        stripFirst.clear(); stripCount.clear();
+        fanFirst.clear(); fanCount.clear();
+        if (vbo) { glDeleteBuffers(1, &vbo); vbo = 0; }
+        if (vao) { glDeleteVertexArrays(1, &vao); vao = 0; }
+        vboFrame = -1;
+        for (auto& l : lods) if (l.ebo) glDeleteBuffers(1, &l.ebo);
+        lods.clear();
+        lodState = GDK_Internal_LODState();
+        animLibrary.clear();
+        radius = -1.0f;
+        InUse = false;
+    }
+};
+
+static std::vector<GDK_Legacy_Model> g_ModelStore;
+
+#endif